@@ -54,6 +54,70 @@ class STM32F103:
     def time_slot(self) -> None:
         self.dut.LibWrapper_TimeSlot()
 
+    def time_slots_elapsed(self, elapsed_slots: int) -> None:
+        self.dut.LibWrapper_TimeSlotsElapsed.argtypes = [ctypes.c_uint32]
+        self.dut.LibWrapper_TimeSlotsElapsed.restype = None
+        self.dut.LibWrapper_TimeSlotsElapsed(ctypes.c_uint32(int(elapsed_slots) & UINT32_MASK))
+
+    def get_idle_slots(self, max_slots: int) -> int:
+        self.dut.LibWrapper_GetIdleSlots.argtypes = [ctypes.c_uint32]
+        self.dut.LibWrapper_GetIdleSlots.restype = ctypes.c_uint32
+        return int(self.dut.LibWrapper_GetIdleSlots(ctypes.c_uint32(int(max_slots) & UINT32_MASK)))
+
+    # ============================================================
+    # Cycle Clock / Scheduler Diagnostics
+    # ============================================================
+
+    def use_virtual_cycle_clock(self, use_virtual: bool) -> None:
+        self.dut.LibWrapper_UseVirtualCycleClock.argtypes = [ctypes.c_bool]
+        self.dut.LibWrapper_UseVirtualCycleClock.restype = None
+        self.dut.LibWrapper_UseVirtualCycleClock(use_virtual)
+
+    def advance_cycle_clock(self, cycles: int) -> None:
+        self.dut.LibWrapper_AdvanceCycleClock.argtypes = [ctypes.c_uint32]
+        self.dut.LibWrapper_AdvanceCycleClock.restype = None
+        self.dut.LibWrapper_AdvanceCycleClock(ctypes.c_uint32(int(cycles) & UINT32_MASK))
+
+    def is_scheduler_lagging(self) -> bool:
+        self.dut.LibWrapper_IsSchedulerLagging.restype = ctypes.c_bool
+        return bool(self.dut.LibWrapper_IsSchedulerLagging())
+
+    def is_slot_overrun(self) -> bool:
+        self.dut.LibWrapper_IsSlotOverrun.restype = ctypes.c_bool
+        return bool(self.dut.LibWrapper_IsSlotOverrun())
+
+    def get_dispatch_latency(self) -> tuple[int, int, int]:
+        """Return (mean, max, max consecutive jitter) of the ISR-to-slot latency in cycles."""
+        values = [ctypes.c_uint32() for _ in range(3)]
+        self.dut.LibWrapper_GetDispatchLatency.argtypes = [ctypes.POINTER(ctypes.c_uint32)] * 3
+        self.dut.LibWrapper_GetDispatchLatency.restype = None
+        self.dut.LibWrapper_GetDispatchLatency(*[ctypes.byref(v) for v in values])
+        return tuple(v.value for v in values)
+
+    def get_recorder_stats(self, recorder_index: int) -> dict[str, int]:
+        """Return the delivered, dropped, coalesced, high-water and rejected counts of one recorder queue."""
+        values = [ctypes.c_uint32() for _ in range(5)]
+        self.dut.LibWrapper_GetRecorderStats.argtypes = [ctypes.c_size_t] + [ctypes.POINTER(ctypes.c_uint32)] * 5
+        self.dut.LibWrapper_GetRecorderStats.restype = None
+        self.dut.LibWrapper_GetRecorderStats(recorder_index, *[ctypes.byref(v) for v in values])
+        return dict(zip(("delivered", "dropped", "coalesced", "high_water", "rejected"), (v.value for v in values)))
+
+    def read_trace(self, max_size: int = 4096) -> bytes:
+        """Drain the scheduler trace as TraceWire blocks (decode with TraceDecoder)."""
+        self.dut.LibWrapper_ReadTrace.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+        self.dut.LibWrapper_ReadTrace.restype = ctypes.c_size_t
+
+        chunks = []
+        buffer = (ctypes.c_uint8 * max_size)()
+
+        while True:
+            length = int(self.dut.LibWrapper_ReadTrace(buffer, max_size))
+            if length == 0:
+                break
+            chunks.append(bytes(buffer[:length]))
+
+        return b"".join(chunks)
+
     # ============================================================
     # Display
     # ============================================================
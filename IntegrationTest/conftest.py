@@ -107,6 +107,25 @@ def cobs_decode(cobs_data: List[int]) -> List[int]:
     return decoded
 
 
+# Core clock cycles per scheduler time slot (5 ms at 72 MHz)
+SLOT_PERIOD_CYCLES = 360_000
+
+
+def run_slot(dut) -> None:
+    """
+    Run one scheduler time slot.
+
+    Advances the virtual cycle clock by one slot period, signals the slot timer as the
+    TIM2 interrupt does, then lets the main loop run the pending slot. The SD card task
+    runs every second slot.
+
+    :param dut: Started device under test, using the virtual cycle clock
+    """
+    dut.advance_cycle_clock(SLOT_PERIOD_CYCLES)
+    dut.time_slot()
+    dut.tick()
+
+
 class UartCapture:
     """Helper class to capture and verify UART transmissions."""
 
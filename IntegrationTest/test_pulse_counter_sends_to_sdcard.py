@@ -6,7 +6,7 @@ and its integration with the simulation environment.
 """
 
 import logging
-from conftest import SdCardOperation
+from conftest import SdCardOperation, run_slot
 
 logger = logging.getLogger(__name__)
 
@@ -18,11 +18,16 @@ def test_sdcard_write_csv(stm32_dut):
 
     logger.info("Starting test: test_sdcard_write_csv")
 
+    stm32_dut.use_virtual_cycle_clock(True)
     stm32_dut.init()
 
-    # Verify initialization sequence
-    assert stm32_dut.sd.count() == 3, "Expected 3 operations after init()"
+    assert stm32_dut.sd.count() == 1, "Expected 1 operation after init()"
     stm32_dut.sd.assert_operation_type(SdCardOperation.INITIALIZE, 0)
+
+    stm32_dut.start()
+
+    # Verify start sequence
+    assert stm32_dut.sd.count() == 3, "Expected 3 operations after start()"
     stm32_dut.sd.assert_operation_type(SdCardOperation.START, 1)
     stm32_dut.sd.assert_operation_type(SdCardOperation.OPEN, 2)
 
@@ -35,66 +40,82 @@ def test_sdcard_write_csv(stm32_dut):
 
     stm32_dut.sd.reset()
 
-    # First tick - should write initial zeros for all 4 pulse counters + 1 extra
-    stm32_dut.tick()
+    # First slot - initial zeros for all 4 pulse counters + 1 extra, in one write
+    run_slot(stm32_dut)
 
     # Verify first batch of writes (initial state with counters at 0)
-    assert stm32_dut.sd.count() == 5, "Expected 5 write operations after first tick"
-
-    for i in range(5):
-        stm32_dut.sd.assert_operation_type(SdCardOperation.WRITE, i)
+    assert stm32_dut.sd.count() == 1, "Expected 1 write operation after first slot"
+    stm32_dut.sd.assert_operation_type(SdCardOperation.WRITE, 0)
 
     # Check the initial zero values written
-    writes = stm32_dut.sd.get_all_writes()
-    assert writes[0] == "0,0\n", f"Expected '0,0\\n', got '{writes[0]}'"
-    assert writes[1] == "1,0\n", f"Expected '1,0\\n', got '{writes[1]}'"
-    assert writes[2] == "2,0\n", f"Expected '2,0\\n', got '{writes[2]}'"
-    assert writes[3] == "3,0\n", f"Expected '3,0\\n', got '{writes[3]}'"
-    assert writes[4] == "4,5\n", f"Expected '4,5\\n', got '{writes[4]}'"
+    lines = stm32_dut.sd.get_all_writes()[0].splitlines(keepends=True)
+    expected_lines = [
+        "0,0,T360000,0\n",
+        "1,0,+0,0\n",
+        "2,0,+0,0\n",
+        "3,0,+0,0\n",
+        "4,5,+0,0\n",
+        "5,0,+0,0\n",
+        "6,0,+0,0\n",
+        "7,0,+0,0\n",
+        "8,0,+0,0\n",
+    ]
+    assert lines == expected_lines, f"Expected {expected_lines}, got {lines}"
 
-    logger.info("Initial writes verified: 4 counters at 0, plus source 4 at 5")
+    logger.info(
+        "Initial writes verified: 4 counters and 4 rates at 0, plus source 4 at 5"
+    )
 
     stm32_dut.sd.reset()
 
-    # Update pulse counters to trigger new measurements
+    # Update pulse counters to trigger new measurements; the SD card task runs every
+    # second slot and writes everything queued since its previous run at once
     stm32_dut.update_pulse_counters([10, 20, 30, 40])
-    stm32_dut.tick()
+    run_slot(stm32_dut)
+    run_slot(stm32_dut)
 
     # Verify second batch of writes (updated counter values)
-    assert stm32_dut.sd.count() == 5, "Expected 5 write operations after second tick"
+    assert stm32_dut.sd.count() == 1, "Expected 1 write operation after two slots"
 
-    writes = stm32_dut.sd.get_all_writes()
-    logger.info("Captured %d write operations", len(writes))
+    lines = stm32_dut.sd.get_all_writes()[0].splitlines(keepends=True)
+    logger.info("Captured %d lines", len(lines))
 
     # Verify the updated measurements
-    assert writes[0] == "0,10\n", f"Expected '0,10\\n', got '{writes[0]}'"
-    assert writes[1] == "1,20\n", f"Expected '1,20\\n', got '{writes[1]}'"
-    assert writes[2] == "2,30\n", f"Expected '2,30\\n', got '{writes[2]}'"
-    assert writes[3] == "3,40\n", f"Expected '3,40\\n', got '{writes[3]}'"
-    assert writes[4] == "4,5\n", f"Expected '4,5\\n', got '{writes[4]}'"
+    expected_lines = [
+        "0,10,T720000,1\n",
+        "1,20,+0,1\n",
+        "2,30,+0,1\n",
+        "3,40,+0,1\n",
+        "4,5,+0,1\n",
+        "4,5,+360000,2\n",
+    ]
+    assert lines == expected_lines, f"Expected {expected_lines}, got {lines}"
 
     logger.info(
         "Updated writes verified: counters at [10, 20, 30, 40], plus source 4 at 5"
     )
 
     # Verify CSV format compliance
-    for i, write_data in enumerate(writes):
-        # Check format: "sourceId,value\n"
-        assert "," in write_data, f"Write {i} missing comma delimiter: '{write_data}'"
-        assert write_data.endswith("\n"), f"Write {i} missing newline: '{write_data}'"
+    for i, line in enumerate(lines):
+        # Check format: "sourceId,value,timestamp,sequence\n"
+        assert "," in line, f"Line {i} missing comma delimiter: '{line}'"
+        assert line.endswith("\n"), f"Line {i} missing newline: '{line}'"
 
-        parts = write_data.strip().split(",")
+        parts = line.strip().split(",")
         assert (
-            len(parts) == 2
-        ), f"Write {i} should have 2 CSV fields, got {len(parts)}: '{write_data}'"
+            len(parts) == 4
+        ), f"Line {i} should have 4 CSV fields, got {len(parts)}: '{line}'"
+
+        # Timestamp: "T<cycles>" absolute, "+<cycles>" delta to the line before
+        assert parts[2][0] in "T+", f"Line {i} timestamp lacks T/+ prefix: '{line}'"
+        parts[2] = parts[2][1:]
 
-        # Verify both parts are numeric
+        # Verify all parts are numeric
         try:
-            source_id = int(parts[0])
-            value = int(parts[1])
-            logger.info("Write %d: source_id=%d, value=%d", i, source_id, value)
+            values = [int(part) for part in parts]
+            logger.info("Line %d: %s", i, values)
         except ValueError as e:
-            assert False, f"Write {i} contains non-numeric data: '{write_data}' - {e}"
+            assert False, f"Line {i} contains non-numeric data: '{line}' - {e}"
 
     logger.info("All CSV format checks passed")
     logger.info("SD card test completed successfully")
@@ -6,7 +6,7 @@ COBS-encoded, and transmitted via UART to the WiFi module.
 """
 
 import logging
-from conftest import cobs_encode
+from conftest import cobs_encode, run_slot
 
 logger = logging.getLogger(__name__)
 
@@ -20,29 +20,53 @@ def test_pulse_counter_sends_initial_values_to_wifi(stm32_dut):
     """
     logger.info("Testing initial pulse counter transmission to WiFi")
 
+    stm32_dut.use_virtual_cycle_clock(True)
     stm32_dut.init()
-    stm32_dut.tick()
+    stm32_dut.start()
+    run_slot(stm32_dut)
 
+    # The virtual cycle clock starts at 0 and advances one slot (360'000 cycles) per
+    # slot. The first frame of a transmission carries the absolute timestamp, the others
+    # the delta to the frame before.
+    # Raw UART data (source 4) is only archived on the SD card, never sent via WiFi.
     # Expected initial state: all counters at zero
     initial_transmissions = [
         cobs_encode(
-            [0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x8B, 0x6B, 0x9F]
-        ),  # Counter 0: 0
+            [0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x81, 0xF9, 0x2B, 0x90, 0xF9, 0xF8, 0xFE]
+        ),  # Counter 0: 0, sequence 0, T360'000
         cobs_encode(
-            [0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA2, 0x0B, 0xA2]
-        ),  # Counter 1: 0
+            [0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0x5B, 0x58, 0xE9, 0x31]
+        ),  # Counter 1: 0, sequence 0, +0
         cobs_encode(
-            [0x0B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xD8, 0xAB, 0xE5]
-        ),  # Counter 2: 0
+            [0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0xB8, 0x5F, 0x66, 0xBF]
+        ),  # Counter 2: 0, sequence 0, +0
         cobs_encode(
-            [0x0B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x54, 0xF1, 0xCB, 0xD8]
-        ),  # Counter 3: 0
+            [0x0E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0x26, 0x5F, 0xCC, 0x73]
+        ),  # Counter 3: 0, sequence 0, +0
         cobs_encode(
-            [0x09, 0x00, 0x04, 0x05, 0x00, 0xF5, 0xC9, 0x4C, 0xB1]
-        ),  # Counter 4: 5
+            [0x0E, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0xA1, 0x56, 0xA3, 0xB5]
+        ),  # Rate 0: 0, sequence 0, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0x42, 0x51, 0x2C, 0x3B]
+        ),  # Rate 1: 0, sequence 0, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0xDC, 0x51, 0x86, 0xF7]
+        ),  # Rate 2: 0, sequence 0, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+            + [0x00, 0x70, 0x43, 0xA6, 0x2E]
+        ),  # Rate 3: 0, sequence 0, +0
     ]
 
-    stm32_dut.uart.assert_all_transmissions(initial_transmissions)
+    # All frames of a slot are sent with one UART transmission
+    stm32_dut.uart.assert_all_transmissions([sum(initial_transmissions, [])])
     logger.info("Initial values transmitted correctly")
 
 
@@ -57,8 +81,10 @@ def test_pulse_counter_sends_updated_values_to_wifi(stm32_dut):
     logger.info("Testing updated pulse counter transmission to WiFi")
 
     # Setup: Initialize system and clear initial transmissions
+    stm32_dut.use_virtual_cycle_clock(True)
     stm32_dut.init()
-    stm32_dut.tick()
+    stm32_dut.start()
+    run_slot(stm32_dut)
     stm32_dut.uart.reset()
 
     # Action: Update pulse counters with test values
@@ -66,23 +92,34 @@ def test_pulse_counter_sends_updated_values_to_wifi(stm32_dut):
     logger.info("Setting pulse counters to: %s", test_values)
     stm32_dut.uart.reset()
     stm32_dut.update_pulse_counters(test_values)
-    stm32_dut.tick()
+    run_slot(stm32_dut)
 
     # Verification: Check transmitted values match expected protocol format
-    # Protocol: [Length(2,LE)][Source(1)][Value(N,LE)][CRC(4,LE)]
+    # Protocol: [Length(2,LE)][Source(1)][Sequence(2,LE)]
+    #           [Value(N,LE)][Timestamp(1..10)][CRC(4,LE)]
     # All values transmitted as Little Endian, COBS-encoded with 0x00 delimiter
     expected_transmissions = [
-        # Counter 0: 307,569,271 (0x12552277) as uint32_t
-        cobs_encode([0x0B, 0x00, 0x00, 0x77, 0x22, 0x55, 0x12, 0x76, 0x59, 0x3F, 0x66]),
-        # Counter 1: 5 as uint32_t
-        cobs_encode([0x0B, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x06, 0x52, 0xD5, 0x95]),
-        # Counter 2: 55,555 (0xD903) as uint32_t
-        cobs_encode([0x0B, 0x00, 0x02, 0x03, 0xD9, 0x00, 0x00, 0xB5, 0x79, 0x46, 0x75]),
-        # Counter 3: 75 (0x4B) as uint32_t
-        cobs_encode([0x0B, 0x00, 0x03, 0x4B, 0x00, 0x00, 0x00, 0x68, 0x2E, 0xDE, 0x94]),
-        # Counter 4: 5 as uint16_t
-        cobs_encode([0x09, 0x00, 0x04, 0x05, 0x00, 0xF5, 0xC9, 0x4C, 0xB1]),
+        # Counter 0: 307,569,271 (0x12552277) as uint32_t, sequence 1, T720'000
+        cobs_encode(
+            [0x10, 0x00, 0x00, 0x01, 0x00, 0x77, 0x22, 0x55, 0x12]
+            + [0x81, 0xF2, 0x57, 0x38, 0x9C, 0x8C, 0x3A]
+        ),
+        # Counter 1: 5 as uint32_t, sequence 1, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x01, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00]
+            + [0x00, 0x9F, 0xDC, 0x7E, 0x5F]
+        ),
+        # Counter 2: 55,555 (0xD903) as uint32_t, sequence 1, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x02, 0x01, 0x00, 0x03, 0xD9, 0x00, 0x00]
+            + [0x00, 0xCF, 0xD8, 0xED, 0x05]
+        ),
+        # Counter 3: 75 (0x4B) as uint32_t, sequence 1, +0
+        cobs_encode(
+            [0x0E, 0x00, 0x03, 0x01, 0x00, 0x4B, 0x00, 0x00, 0x00]
+            + [0x00, 0xCA, 0x3D, 0x98, 0xFA]
+        ),
     ]
 
-    stm32_dut.uart.assert_all_transmissions(expected_transmissions)
+    stm32_dut.uart.assert_all_transmissions([sum(expected_transmissions, [])])
     logger.info("Updated values transmitted correctly")
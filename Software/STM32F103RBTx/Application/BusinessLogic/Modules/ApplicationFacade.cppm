@@ -8,20 +8,34 @@ module;
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <utility>
 
 export module BusinessLogic.ApplicationFacade;
 
 import BusinessLogic.ApplicationComponent;
+import BusinessLogic.BackgroundJob;
 import BusinessLogic.MeasurementCoordinator;
+import BusinessLogic.MeasurementPipeline;
+import BusinessLogic.MeasurementRouting;
+import BusinessLogic.PulseCaptureTask;
+import BusinessLogic.ReportFilter;
+import BusinessLogic.RollupAggregator;
 
 import BusinessLogic.SlotTableScheduler;
+import BusinessLogic.SlotTableSynthesizer;
+import BusinessLogic.SchedulerProfiler;
+import BusinessLogic.SchedulerTrace;
 import BusinessLogic.TaskId;
 
 import Device;
 
 import Driver.PlatformFactory;
 import Driver.CycleBudget;
+import Driver.CycleCpu;
+import Driver.PulseCounterDriver;
+import Driver.UartDriver;
+import Driver.IsrEvent;
 
 export namespace BusinessLogic
 {
@@ -79,6 +93,101 @@ export namespace BusinessLogic
          */
         auto onTimeSlot() noexcept -> void;
 
+        /**
+         * @brief Signals the end of a stretched tickless-idle timer period.
+         *
+         * Intended to be called from the timer interrupt instead of onTimeSlot() when the period
+         * was programmed from getIdleSlots().
+         *
+         * @param elapsedSlots Number of slot periods covered by the timer period (>= 1).
+         */
+        auto onTimeSlotsElapsed(std::uint32_t elapsedSlots) noexcept -> void;
+
+        /**
+         * @brief Returns how many slot periods the main loop may sleep before work is due.
+         *
+         * @param maxSlots Longest timer period the platform can program, in slots.
+         * @return Number of slot periods in [1, maxSlots]; 1 means tick normally.
+         */
+        [[nodiscard]] auto getIdleSlots(std::uint32_t maxSlots) const noexcept -> std::uint32_t;
+
+        /**
+         * @brief Signals a hardware event to the scheduler.
+         *
+         * Intended to be registered with Driver::IsrEventNotifier; runs in interrupt context.
+         *
+         * @param event Event reported by a driver interrupt.
+         */
+        auto onIsrEvent(Driver::IsrEvent event) noexcept -> void;
+
+        /**
+         * @brief Writes scheduler cycle statistics to the USB UART.
+         *
+         * @details
+         * Emits one CSV line per task and per slot (see SchedulerProfileReport). Only available
+         * when the firmware is built with HDL_SCHEDULER_PROFILING; otherwise nothing is sent.
+         *
+         * @return true if every line was transmitted; false if profiling is disabled or a
+         *         transmission failed.
+         */
+        [[nodiscard]] auto dumpSchedulerProfile() noexcept -> bool;
+
+        /**
+         * @brief Drains the scheduler trace to the USB UART.
+         *
+         * @details
+         * Sends TraceWire blocks until the trace ring is empty. Only available when the
+         * firmware is built with HDL_SCHEDULER_TRACE; otherwise nothing is sent.
+         *
+         * @return true if every block was transmitted; false if tracing is disabled or a
+         *         transmission failed.
+         */
+        [[nodiscard]] auto dumpTrace() noexcept -> bool;
+
+        /**
+         * @brief Drains the scheduler trace into a caller buffer.
+         *
+         * @details
+         * Used by the simulation, which has no USB UART consumer. Writes one TraceWire block.
+         *
+         * @param buffer Destination for the encoded block.
+         * @return Encoded block size, or 0 if there is nothing to read or tracing is disabled.
+         */
+        [[nodiscard]] auto readTrace(std::span<std::uint8_t> buffer) noexcept -> std::size_t;
+
+        /**
+         * @brief Returns the scheduler diagnostics (lag, overrun, load shedding).
+         */
+        [[nodiscard]] auto getSchedulerStatus() const noexcept -> const Status &;
+
+        /**
+         * @brief Returns the fill level diagnostics of one recorder queue.
+         *
+         * @param recorderIndex 0 = WiFi, 1 = SD card.
+         */
+        [[nodiscard]] auto getRecorderQueueStats(std::size_t recorderIndex) const noexcept -> RecorderQueueStats;
+
+        /**
+         * @brief Queues a long-running operation to run in the slack after the slot tasks.
+         *
+         * @details
+         * Intended for work that does not fit a slot budget (SD sync, display redraw, file
+         * rotation). The job is called with the remaining cycle budget of the slot until it
+         * returns DONE or FAILED; see SlotTableScheduler::submitJob().
+         *
+         * @param job Job delegate; the bound object must outlive its time in the queue.
+         * @return false if the background queue is full.
+         */
+        [[nodiscard]] auto submitBackgroundJob(BackgroundJob job) noexcept -> bool;
+
+        /**
+         * @brief Returns the inter-arrival histogram of the captured pulse input.
+         *
+         * @details
+         * Empty unless the firmware is built with PULSE_CAPTURE_ENABLED.
+         */
+        [[nodiscard]] auto getCaptureHistogram() const noexcept -> const Device::InterArrivalHistogram &;
+
     private:
         /// Number of recorders connected to the measurement coordinator.
         static constexpr std::size_t RECORDERS_COUNT{2U};
@@ -94,6 +203,58 @@ export namespace BusinessLogic
         Device::PulseCounterSource pulseCounter4;
         Device::UartSource uartReceiver;
 
+        /**
+         * @brief Unit of the pulse rates reported next to the counts.
+         *
+         * @details
+         * Counts per minute is the usual unit for Geiger-Müller tubes on the BNC inputs.
+         */
+        static constexpr Device::RateUnit PULSE_RATE_UNIT{Device::RateUnit::PER_MINUTE};
+
+        /**
+         * @brief Dead time of the detectors on the BNC inputs, in nanoseconds.
+         *
+         * @details
+         * 0 reports the measured rate. Set it to the tube dead time (typically 50'000 to
+         * 200'000 ns for Geiger-Müller tubes) to report the true rate of a non-paralyzable
+         * detector.
+         */
+        static constexpr std::uint32_t PULSE_RATE_DEAD_TIME_NS{0U};
+
+        /**
+         * @brief Gate period of the pulse counters, in milliseconds.
+         *
+         * @details
+         * 0 reads every counter live when its source runs. Otherwise a timer latches all four
+         * counters together once per period, and the pulse sources report once per gate with
+         * the gate time, so the counts of different inputs describe the same instant.
+         */
+        static constexpr std::uint32_t PULSE_GATE_PERIOD_MS{0U};
+
+        Device::PulseRateSource pulseRate1;
+        Device::PulseRateSource pulseRate2;
+        Device::PulseRateSource pulseRate3;
+        Device::PulseRateSource pulseRate4;
+
+        /**
+         * @brief Gate of the reciprocal frequency measurement, in milliseconds.
+         *
+         * @details
+         * Sets the measurement time, hence the resolution: the EXTI latency over the gate, as the
+         * edge interrupt shares priority 0 with TIM2, USB, DMA, TIM1 and TIM4 (about 10 ppm
+         * here). Slower inputs are measured over several gates, down to about one edge per
+         * ReciprocalFrequencyMeter::MAX_GATE_MS.
+         */
+        static constexpr std::uint32_t FREQUENCY_GATE_MS{1'000U};
+
+        static_assert(FREQUENCY_GATE_MS <= Device::ReciprocalFrequencyMeter::MAX_GATE_MS,
+                      "Frequency gate must stay within one cycle counter wrap");
+
+        Device::FrequencySource frequency1;
+        Device::FrequencySource frequency2;
+        Device::FrequencySource frequency3;
+        Device::FrequencySource frequency4;
+
         using SourceArray =
             std::array<Device::SourceVariant, SOURCES_COUNT>;
 
@@ -109,13 +270,202 @@ export namespace BusinessLogic
 
         RecorderArray recorders;
 
+        /**
+         * @brief Measurements buffered per recorder.
+         *
+         * @details
+         * Covers the SD card recorder draining every second slot while the counters and the UART
+         * report in every slot, with headroom for a slow sync. Rates change at most once per
+         * window bucket (100 ms or 5 s) and frequencies once per gate, so they add little load.
+         */
+        static constexpr std::size_t RECORDER_QUEUE_CAPACITY{16U};
+
+        /// Recorder positions in the recorder array, drained by their own tasks.
+        static constexpr std::size_t WIFI_RECORDER_INDEX{0U};
+        static constexpr std::size_t SD_CARD_RECORDER_INDEX{1U};
+
+        static constexpr RecorderMask ALL_RECORDERS{
+            recorderBit(WIFI_RECORDER_INDEX) | recorderBit(SD_CARD_RECORDER_INDEX)};
+
+        /**
+         * @brief Recorders fed by each source, in source array order.
+         *
+         * @details
+         * Pulse counters, their rates and frequencies go to every recorder. Raw UART instrument
+         * data is only archived on the SD card; the WiFi link is kept for the low-rate counter
+         * values.
+         */
+        static constexpr RoutingTable<SOURCES_COUNT, RECORDERS_COUNT> measurementRouting{{
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            recorderBit(SD_CARD_RECORDER_INDEX),
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS,
+            ALL_RECORDERS}};
+
+        /**
+         * @brief 1 s / 1 min / 1 h rollups of every source, written to their own SD card files.
+         *
+         * @details
+         * Long deployments can be analysed from the rollup files without reading the raw log.
+         * The output buffer holds the rollups of all tiers closing at once (an hour boundary).
+         */
+        static constexpr std::size_t ROLLUP_CAPACITY{64U};
+
+        static_assert(ROLLUP_TIER_COUNT * SOURCES_COUNT <= ROLLUP_CAPACITY,
+                      "Rollup output buffer must hold one rollup per source and tier");
+
+        using Rollups = BusinessLogic::RollupAggregator<ROLLUP_CAPACITY>;
+
         using MeasurementCoordinatorType =
             BusinessLogic::MeasurementCoordinator<
                 SourceArray,
-                RecorderArray>;
+                RecorderArray,
+                RECORDER_QUEUE_CAPACITY,
+                measurementRouting,
+                PipelineSet<>,
+                Rollups>;
+
+        /// Heartbeat of unchanged pulse counters; MEASUREMENT runs once per slot.
+        static constexpr std::uint32_t PULSE_COUNTER_HEARTBEAT_TICKS{(10U * 1'000U) / SLOT_PERIOD_MS};
+
+        static constexpr ReportPolicy PULSE_COUNTER_REPORT_POLICY{
+            .mode = ReportMode::ON_CHANGE,
+            .deadband = 0U,
+            .heartbeatTicks = PULSE_COUNTER_HEARTBEAT_TICKS};
+
+        /**
+         * @brief Report-by-exception policy per MeasurementDeviceId.
+         *
+         * @details
+         * Pulse counters, rates and frequencies repeat their value while the input is idle, so
+         * they only report changes plus a 10 s heartbeat. UART frames are reported as received.
+         */
+        static constexpr ReportPolicyTable reportPolicies{
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            ReportPolicy{},
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY,
+            PULSE_COUNTER_REPORT_POLICY};
+
+        /**
+         * @brief Overflow policy per recorder, in recorder array order.
+         *
+         * @details
+         * The WiFi link shows live values, so a congested link keeps the latest value of every
+         * source. The SD card is the archive; its queue keeps the oldest data and counts what
+         * it had to reject, so gaps in the log are visible in the sequence numbers.
+         */
+        static constexpr MeasurementCoordinatorType::OverflowPolicyTable overflowPolicies{
+            OverflowPolicy::COALESCE_LATEST,
+            OverflowPolicy::DROP_NEWEST};
 
         MeasurementCoordinatorType measurement;
 
+        /**
+         * @brief Timestamps every pulse of bncC for inter-arrival histograms.
+         *
+         * @details
+         * Off by default: the input then counts like the others. Only bncB and bncC can be
+         * captured (see Driver::PulseCounterDriver::startCapture()).
+         */
+        static constexpr bool PULSE_CAPTURE_ENABLED{false};
+
+        /// Capture timer rate: 1 us resolution, intervals up to 65.5 ms.
+        static constexpr std::uint32_t PULSE_CAPTURE_TICK_HZ{1'000'000U};
+
+        using PulseCapture = PulseCaptureTask<Driver::PulseCounterDriver>;
+
+        PulseCapture pulseCapture;
+
+        /**
+         * @brief SD card task: drains the measurement queue, then writes closed rollups.
+         *
+         * @details
+         * Rollups are written by a background job, one SD card call per slice in the slot slack
+         * (see Device::SdCardRecorder::writeRollups()), so the file switches do not overrun
+         * the slot. The queue is still drained while the job runs: the recorder buffers the
+         * measurements until the job has reopened the raw log. No new rollups are handed over
+         * until the job is done.
+         */
+        class SdCardTask final
+        {
+        public:
+            SdCardTask(ApplicationFacade &facade,
+                       MeasurementCoordinatorType &coordinator,
+                       Device::SdCardRecorder &recorder) noexcept
+                : facade(facade),
+                  coordinator(coordinator),
+                  recorder(recorder)
+            {
+            }
+
+            [[nodiscard]] auto tick() noexcept -> bool
+            {
+                bool status{true};
+
+                if (rollupWrite.isDone())
+                {
+                    status = rollupWrite.succeeded();
+                    rollupWrite = Device::CoTask{};
+                }
+
+                status = coordinator.drainRecorder(SD_CARD_RECORDER_INDEX) && status;
+
+                if (!rollupWrite.isValid())
+                {
+                    status = coordinator.getTap().flush(*this) && status;
+                }
+
+                return status;
+            }
+
+            /**
+             * @brief Starts the background job writing @p rollups; called by Rollups::flush().
+             *
+             * @return false if the job could not be started; Rollups::flush() retries them then.
+             */
+            [[nodiscard]] auto writeRollups(std::span<const Device::MeasurementRollup> rollups) noexcept -> bool
+            {
+                rollupWrite = recorder.writeRollups(rollups);
+
+                const bool status = rollupWrite.isValid() && facade.submitBackgroundJob(BackgroundJob{rollupJob});
+
+                if (!status) [[unlikely]]
+                {
+                    rollupWrite = Device::CoTask{};
+                }
+
+                return status;
+            }
+
+        private:
+            ApplicationFacade &facade;
+            MeasurementCoordinatorType &coordinator;
+            Device::SdCardRecorder &recorder;
+
+            /// Rollup write in progress; invalid when none.
+            Device::CoTask rollupWrite;
+            CoTaskJob rollupJob{rollupWrite};
+        };
+
+        SdCardTask sdCardTask;
+
         //   std::array<Device::RecorderVariant, RECORDERS_COUNT> recorders;
 
         /// Measurement routing and aggregation.
@@ -128,54 +478,133 @@ export namespace BusinessLogic
 
         /// Scheduler configuration.
         static constexpr std::size_t SLOTS_PER_CYCLE{4U};
-        static constexpr std::size_t MAX_TASKS_PERSLOT{2U};
+        static constexpr std::size_t MAX_TASKS_PERSLOT{4U};
         static_assert(MAX_TASKS_PERSLOT > 0U, "MAX_TASKS_PERSLOT must be greater than 0.");
 
-        using Scheduler = BusinessLogic::SlotTableScheduler<SLOTS_PER_CYCLE, MAX_TASKS_PERSLOT>;
+#if defined(HDL_SCHEDULER_PROFILING)
+        using SchedulerProfiler = BusinessLogic::CycleProfiler<SLOTS_PER_CYCLE>;
+#else
+        using SchedulerProfiler = BusinessLogic::NoProfiling;
+#endif
 
-        /// Slot schedule defining per-slot task order and budget.
-        static constexpr std::array<Scheduler::Slot, SLOTS_PER_CYCLE> slotTable = {{
-            Scheduler::Slot{.taskIds{TaskId::MEASUREMENT, TaskId::KEYBOARD},
-                            .taskIdCount = 2U,
-                            .budgetCycles = Driver::CycleBudget::fromUs(72'000'000U, 700U)},
-            Scheduler::Slot{.taskIds{TaskId::MEASUREMENT},
-                            .taskIdCount = 1U,
-                            .budgetCycles = Driver::CycleBudget::fromUs(72'000'000U, 500U)},
-            Scheduler::Slot{.taskIds{TaskId::MEASUREMENT, TaskId::KEYBOARD},
-                            .taskIdCount = 2U,
-                            .budgetCycles = Driver::CycleBudget::fromUs(72'000'000U, 700U)},
-            Scheduler::Slot{.taskIds{TaskId::MEASUREMENT},
-                            .taskIdCount = 1U,
-                            .budgetCycles = Driver::CycleBudget::fromUs(72'000'000U, 500U)},
+        using Scheduler = BusinessLogic::SlotTableScheduler<SLOTS_PER_CYCLE, MAX_TASKS_PERSLOT, SchedulerProfiler>;
+
+        /// SD_CARD_RECORDER period; it also paces the rollup writes.
+        static constexpr std::uint32_t SD_CARD_PERIOD_SLOTS{2U};
+
+        /**
+         * @brief Task rates and WCET budgets.
+         *
+         * @details
+         * The slot table is generated from these declarations at compile time. A new task only
+         * needs an entry here; the build fails if it does not fit the 5 ms slot period.
+         */
+        static constexpr std::array<TaskDeclaration, 4U> baseTaskDeclarations{{
+            {.taskId = TaskId::MEASUREMENT,
+             .periodSlots = 1U,
+             .offsetSlots = 0U,
+             .wcetCycles = Driver::CycleBudget::fromUs(500U)},
+            {.taskId = TaskId::KEYBOARD,
+             .periodSlots = 2U,
+             .offsetSlots = AUTO_OFFSET,
+             .wcetCycles = Driver::CycleBudget::fromUs(200U)},
+            {.taskId = TaskId::WIFI_RECORDER,
+             .periodSlots = 1U,
+             .offsetSlots = 0U,
+             .wcetCycles = Driver::CycleBudget::fromUs(1'000U)},
+            {.taskId = TaskId::SD_CARD_RECORDER,
+             .periodSlots = SD_CARD_PERIOD_SLOTS,
+             .offsetSlots = AUTO_OFFSET,
+             .wcetCycles = Driver::CycleBudget::fromUs(2'500U)},
         }};
 
+        /// Declared only with PULSE_CAPTURE_ENABLED, so its budget is not reserved otherwise.
+        static constexpr TaskDeclaration pulseCaptureDeclaration{
+            .taskId = TaskId::PULSE_CAPTURE,
+            .periodSlots = 1U,
+            .offsetSlots = 0U,
+            .wcetCycles = Driver::CycleBudget::fromUs(300U)};
+
+        /// Task set the slot table is generated from.
+        static constexpr auto taskDeclarations = []() consteval
+        {
+            if constexpr (PULSE_CAPTURE_ENABLED)
+            {
+                return std::array<TaskDeclaration, baseTaskDeclarations.size() + 1U>{
+                    baseTaskDeclarations[0U],
+                    baseTaskDeclarations[1U],
+                    baseTaskDeclarations[2U],
+                    baseTaskDeclarations[3U],
+                    pulseCaptureDeclaration};
+            }
+            else
+            {
+                return baseTaskDeclarations;
+            }
+        }();
+
+        /**
+         * @brief Measurements the SD card recorder receives per SD_CARD_RECORDER period, at most.
+         *
+         * @details
+         * The four counters and the UART report once per slot. Rates report at most once per
+         * 100 ms bucket and frequencies once per gate; one of them per period covers both.
+         */
+        static constexpr std::size_t SD_CARD_MEASUREMENTS_PER_PERIOD{(5U * SD_CARD_PERIOD_SLOTS) + 1U};
+
+        // The SD card slot may use its whole background window at WCET, so a rollup write is
+        // only certain to get one slice per SD_CARD_RECORDER period. The extra period covers
+        // measurements queued before the raw log was closed.
+        static_assert(SD_CARD_MEASUREMENTS_PER_PERIOD *
+                              (Device::SdCardRecorder::getRollupWriteSlices(Rollups::FLUSH_BATCH) + 1U) <=
+                          Device::SdCardRecorder::PENDING_CAPACITY,
+                      "SD card recorder must buffer the measurements of a worst-case rollup write");
+
+        /// Slot schedule defining per-slot task order and budget.
+        static constexpr Scheduler::SlotTable slotTable =
+            SlotTableSynthesizer<Scheduler, taskDeclarations>::SLOT_TABLE;
+
+        /**
+         * @brief Trigger events per task (zero = periodic).
+         *
+         * @details
+         * MEASUREMENT stays periodic: sources report their state every slot and recorders rely
+         * on that cadence. KEYBOARD is polled because keys have no interrupt line. Recorder
+         * tasks drain their queues periodically, and PULSE_CAPTURE its ring when it is declared.
+         */
+        static constexpr Scheduler::TaskTriggerTable taskTriggers{0U, 0U, 0U, 0U, 0U};
+
+        /**
+         * @brief Part of each slot available to background jobs, measured from the slot start.
+         *
+         * @details
+         * The last millisecond of the 5 ms slot is kept free for interrupt load so background
+         * slices do not delay the next slot.
+         */
+        static constexpr Driver::CycleCpu backgroundWindowCycles{
+            SLOT_PERIOD_CYCLES - Driver::CycleBudget::fromMs(1U)};
+
         /// Task dispatch table indexed by TaskId.
         Scheduler::TaskCallTable taskCallTable;
 
         /// Slot-table scheduler instance.
         Scheduler scheduler;
 
-        /**
-         * @brief Validates slotTable at compile time.
-         * @return true if slotTable is internally consistent.
-         */
-        static consteval auto validateSlotTable() -> bool
-        {
-            bool ok = true;
+        /// Diagnostics output used for scheduler profile dumps.
+        Driver::UartDriver &usbUart;
 
-            for (const auto &slot : slotTable)
-            {
-                ok = ok && (slot.taskIdCount <= MAX_TASKS_PERSLOT);
+        /// Timeout for one profile line on the USB UART.
+        static constexpr std::uint32_t PROFILE_TX_TIMEOUT_MS{10U};
 
-                for (std::uint8_t i = 0U; i < slot.taskIdCount; ++i)
-                {
-                    const auto id = std::to_underlying(slot.taskIds[i]);
-                    ok = ok && (id < std::to_underlying(TaskId::LAST_NOT_USED));
-                }
-            }
+        /// Timeout for one trace block on the USB UART.
+        static constexpr std::uint32_t TRACE_TX_TIMEOUT_MS{20U};
+
+        /// Upper bound of blocks sent by one dumpTrace() call (one full ring plus a partial block).
+        static constexpr std::size_t MAX_TRACE_BLOCKS_PER_DUMP{
+            (TRACE_CAPACITY / SchedulerTrace::BLOCK_RECORDS) + 1U};
 
-            return ok;
-        }
+        /// The USB UART is only used for diagnostics output.
+        static constexpr bool DIAGNOSTICS_UART_ENABLED{SchedulerProfiler::ENABLED || TRACE_ENABLED};
     };
 
 } // namespace BusinessLogic
\ No newline at end of file
@@ -0,0 +1,230 @@
+/**
+ * @file BackgroundJob.cppm
+ * @brief Sliced background jobs executed by SlotTableScheduler in the slack after slot tasks.
+ */
+module;
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+export module BusinessLogic.BackgroundJob;
+
+import Device.CoTask;
+
+import Driver.CycleCpu;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief Result of one background job slice.
+     */
+    enum class JobState : std::uint8_t
+    {
+        /// @brief The job finished and is removed from the queue.
+        DONE = 0,
+
+        /// @brief The job has more work and is queued again for a later slice.
+        MORE_WORK,
+
+        /// @brief The job gave up; it is removed from the queue and counted as failed.
+        FAILED
+    };
+
+    /**
+     * @brief Concept for objects that can run as a sliced background job.
+     *
+     * @details
+     * runSlice() receives the cycle budget left in the current slot. A job should do at most
+     * that much work (e.g. one sector of a sync, one display band) and return MORE_WORK if it
+     * is not finished. Exceeding the budget delays the next slot, it is not preempted.
+     */
+    template <typename T>
+    concept BackgroundJobConcept = requires(T job, Driver::CycleCpu budgetCycles) {
+        { job.runSlice(budgetCycles) } noexcept -> std::same_as<JobState>;
+    };
+
+    /**
+     * @brief Non-owning, allocation-free delegate that calls runSlice() on a job object.
+     *
+     * @details
+     * Same layout as TickDelegate (object pointer plus wrapper function pointer), but
+     * default-constructible as an unbound entry so it can be stored in a fixed-size queue.
+     *
+     * Lifetime: non-owning. The bound object must outlive its time in the queue.
+     */
+    class BackgroundJob final
+    {
+    public:
+        using WrapperFn = JobState (*)(void *, Driver::CycleCpu) noexcept;
+
+        BackgroundJob() = default;
+
+        BackgroundJob(const BackgroundJob &) = default;
+        BackgroundJob &operator=(const BackgroundJob &) = default;
+        BackgroundJob(BackgroundJob &&) = default;
+        BackgroundJob &operator=(BackgroundJob &&) = default;
+
+        template <BackgroundJobConcept T>
+        explicit BackgroundJob(T &obj) noexcept
+            : objectPtr(std::addressof(obj)), wrapperFn(&wrapper<T>)
+        {
+        }
+
+        [[nodiscard]] auto operator()(Driver::CycleCpu budgetCycles) const noexcept -> JobState
+        {
+            JobState result = JobState::FAILED;
+
+            if (isBound()) [[likely]]
+            {
+                result = wrapperFn(objectPtr, budgetCycles);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] auto isBound() const noexcept -> bool
+        {
+            const bool result = (objectPtr != nullptr) && (wrapperFn != nullptr);
+            return result;
+        }
+
+    private:
+        void *objectPtr{nullptr};
+        WrapperFn wrapperFn{nullptr};
+
+        template <BackgroundJobConcept T>
+        static auto wrapper(void *objPtr, Driver::CycleCpu budgetCycles) noexcept -> JobState
+        {
+            return static_cast<T *>(objPtr)->runSlice(budgetCycles);
+        }
+    };
+
+    /**
+     * @brief Runs a Device::CoTask as a background job, one resume per slice.
+     *
+     * @details
+     * Lets a multi-slot operation written as a coroutine use the slot slack instead of a slot
+     * of its own. The budget is not passed on; each coroutine step must be short.
+     *
+     * Lifetime: non-owning. The task must outlive the job.
+     */
+    class CoTaskJob final
+    {
+    public:
+        explicit CoTaskJob(Device::CoTask &coTask) noexcept
+            : task(coTask)
+        {
+        }
+
+        [[nodiscard]] auto runSlice(Driver::CycleCpu budgetCycles) noexcept -> JobState
+        {
+            static_cast<void>(budgetCycles);
+
+            JobState result = JobState::MORE_WORK;
+
+            if (!task.tick())
+            {
+                result = JobState::FAILED;
+            }
+            else if (task.isDone())
+            {
+                result = JobState::DONE;
+            }
+
+            return result;
+        }
+
+    private:
+        Device::CoTask &task;
+    };
+
+    /**
+     * @brief Fixed-capacity FIFO of background jobs.
+     *
+     * @tparam Capacity Maximum number of queued jobs.
+     *
+     * @details
+     * Not ISR-safe: jobs are submitted and executed from the main loop context only.
+     */
+    template <std::size_t Capacity>
+    class BackgroundJobQueue final
+    {
+    public:
+        /// @brief Maximum number of queued jobs.
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        /**
+         * @brief Appends a job.
+         *
+         * @return false if the queue is full or the job is unbound.
+         */
+        [[nodiscard]] auto push(BackgroundJob job) noexcept -> bool
+        {
+            bool result = false;
+
+            if ((count < Capacity) && job.isBound())
+            {
+                jobs[(head + count) % Capacity] = job;
+                ++count;
+                result = true;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Removes and returns the oldest job; returns an unbound job if empty.
+         */
+        [[nodiscard]] auto pop() noexcept -> BackgroundJob
+        {
+            BackgroundJob result{};
+
+            if (count != 0U)
+            {
+                result = jobs[head];
+                jobs[head] = BackgroundJob{};
+                (++head) %= Capacity;
+                --count;
+            }
+
+            return result;
+        }
+
+        /// @brief Number of queued jobs.
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return count;
+        }
+
+        [[nodiscard]] auto isEmpty() const noexcept -> bool
+        {
+            return (count == 0U);
+        }
+
+        /// @brief Drops all queued jobs.
+        auto clear() noexcept -> void
+        {
+            jobs = {};
+            head = 0U;
+            count = 0U;
+        }
+
+    private:
+        std::array<BackgroundJob, Capacity> jobs{};
+        std::size_t head{0U};
+        std::size_t count{0U};
+
+        static_assert(Capacity > 0U, "BackgroundJobQueue capacity must be greater than zero.");
+    };
+
+    static_assert(std::is_trivially_copyable_v<BackgroundJob>,
+                  "BackgroundJob should be trivially copyable (two pointers) for queue storage.");
+
+    static_assert(sizeof(BackgroundJob) == (sizeof(void *) + sizeof(BackgroundJob::WrapperFn)),
+                  "BackgroundJob is expected to be exactly two pointers in size.");
+} // namespace BusinessLogic
@@ -1,14 +1,25 @@
 module;
 
+#include <cstddef>
 #include <cstdint>
 #include <array>
+#include <bit>
+#include <tuple>
+#include <utility>
 #include <variant>
 #include <ranges>
+#include <span>
 #include <functional>
 
 export module BusinessLogic.MeasurementCoordinator;
 
 import BusinessLogic.ApplicationComponent;
+import BusinessLogic.MeasurementPipeline;
+import BusinessLogic.MeasurementRouting;
+import BusinessLogic.ReportFilter;
+import BusinessLogic.SpscQueue;
+import BusinessLogic.SchedulerTrace;
+import BusinessLogic.TraceFormat;
 import Device;
 
 export namespace BusinessLogic
@@ -47,20 +58,164 @@ export namespace BusinessLogic
         return result;
     }
 
+    // ------------------------------------------------------------
+    // visit_at : applies f(obj) to the element at one index
+    // ------------------------------------------------------------
+    template <std::ranges::random_access_range Range, class F>
+    inline auto visit_at(Range &range, std::size_t index, F &&f) noexcept -> void
+    {
+        std::visit(
+            [&](auto &ref) noexcept
+            {
+                f(ref.get());
+            },
+            range[index]);
+    }
+
+    /**
+     * @brief What happens to a measurement for a recorder whose queue is full.
+     */
+    enum class OverflowPolicy : std::uint8_t
+    {
+        /// @brief The new measurement is discarded; the recorder keeps the older history.
+        DROP_NEWEST = 0,
+
+        /// @brief The oldest queued measurement is evicted; the recorder keeps the recent history.
+        DROP_OLDEST,
+
+        /**
+         * @brief The newest measurement of each source waits outside the queue.
+         *
+         * A newer measurement of the same source replaces it. Suits live views that only
+         * care about the current value of every channel.
+         */
+        COALESCE_LATEST
+    };
+
+    /**
+     * @brief Fill level and loss diagnostics of one recorder queue.
+     */
+    struct RecorderQueueStats final
+    {
+        /// @brief Measurements currently waiting for the recorder.
+        std::uint32_t depth{0U};
+
+        /// @brief Highest number of waiting measurements observed.
+        std::uint32_t highWater{0U};
+
+        /// @brief Measurements lost because the queue was full (rejected or evicted).
+        std::uint32_t dropped{0U};
+
+        /// @brief Measurements replaced by a newer one of the same source (COALESCE_LATEST).
+        std::uint32_t coalesced{0U};
+
+        /// @brief Measurements handed to the recorder in batches it accepted.
+        std::uint32_t delivered{0U};
+
+        /// @brief Measurements handed to the recorder in batches it rejected; they are not retried.
+        std::uint32_t rejected{0U};
+    };
+
     // ------------------------------------------------------------
     // MeasurementCoordinator
     // ------------------------------------------------------------
+
+    /**
+     * @brief Moves measurements from sources to recorders.
+     *
+     * @tparam SourceRange   Array of source variants.
+     * @tparam RecorderRange Array of recorder variants.
+     * @tparam QueueCapacity Measurements buffered per recorder; must be a power of two.
+     * @tparam Routing       Recorders fed by each source; every source feeds every recorder by default.
+     * @tparam Pipelines     PipelineSet with the processing stages of each source; none by default.
+     * @tparam Tap           Observer of every measurement that left its pipeline; none by default.
+     *
+     * @details
+     * onTick() samples the sources and appends every new measurement to the SpscQueue of each
+     * recorder the source is routed to. The routing table is a template argument, so the
+     * source × recorder loops are unrolled at compile time and unrouted pairs generate no
+     * code; a source routed nowhere is not even polled. Each measurement first passes the
+     * pipeline of its source (scaling, decimation, averaging, ...), which is inlined here as
+     * well and may drop it. Each recorder is fed from its queue by drainRecorder(), normally
+     * called from a scheduler task of its own (see getRecorderTask()), so a slow recorder (e.g.
+     * an SD card sync) only delays itself and never the sampling or the other recorders.
+     * Everything queued since the previous drain, possibly from several ticks, is handed over
+     * in one Device::notifyBatch() call, as the columns of a Device::MeasurementBatch. Sources
+     * with a ReportMode::ON_CHANGE policy only pass on measurements that left their deadband,
+     * plus a heartbeat (see ReportFilter). Reported measurements get a per-source sequence
+     * number, so a receiver can detect gaps. When a recorder falls behind by more than
+     * QueueCapacity measurements, its OverflowPolicy decides which measurements are lost;
+     * losses are counted per recorder.
+     */
     template <
         std::ranges::forward_range SourceRange,
-        std::ranges::forward_range RecorderRange>
+        std::ranges::random_access_range RecorderRange,
+        std::size_t QueueCapacity = 8U,
+        RoutingTable<std::tuple_size_v<SourceRange>, std::tuple_size_v<RecorderRange>> Routing =
+            RoutingTable<std::tuple_size_v<SourceRange>, std::tuple_size_v<RecorderRange>>::all(),
+        typename Pipelines = PipelineSet<>,
+        MeasurementTap Tap = NoTap>
     class MeasurementCoordinator final : public ApplicationComponent
     {
     public:
+        /// @brief Number of sources sampled by onTick().
+        static constexpr std::size_t SOURCE_COUNT = std::tuple_size_v<SourceRange>;
+
+        /// @brief Number of recorders, one queue each.
+        static constexpr std::size_t RECORDER_COUNT = std::tuple_size_v<RecorderRange>;
+
+        /// @brief Recorders fed by each source.
+        static constexpr auto ROUTING = Routing;
+
+        /// @brief Overflow policy per recorder, same order as the recorder range.
+        using OverflowPolicyTable = std::array<OverflowPolicy, RECORDER_COUNT>;
+
+        static_assert(ROUTING.isValid(), "Routing table names a recorder outside the recorder range.");
+
+        /// @brief Measurements buffered per recorder.
+        static constexpr std::size_t QUEUE_CAPACITY = QueueCapacity;
+
+        /**
+         * @brief Scheduler task draining the queue of one recorder.
+         *
+         * @details
+         * Satisfies TickableConcept, so it can be bound to a TickDelegate.
+         */
+        class RecorderTask final
+        {
+        public:
+            constexpr RecorderTask(MeasurementCoordinator &owner, std::size_t recorderIndex) noexcept
+                : coordinator(owner),
+                  index(recorderIndex)
+            {
+            }
+
+            [[nodiscard]] auto tick() noexcept -> bool
+            {
+                return coordinator.drainRecorder(index);
+            }
+
+        private:
+            MeasurementCoordinator &coordinator;
+            std::size_t index;
+        };
+
+        /**
+         * @param sourcesRange   Measurement sources.
+         * @param recordersRange Measurement recorders.
+         * @param reportPolicies Report-by-exception policy per source; must outlive the coordinator.
+         * @param overflow       Overflow policy per recorder; DROP_NEWEST by default.
+         */
         constexpr MeasurementCoordinator(
             SourceRange &sourcesRange,
-            RecorderRange &recordersRange) noexcept
+            RecorderRange &recordersRange,
+            const ReportPolicyTable &reportPolicies = REPORT_ALWAYS,
+            const OverflowPolicyTable &overflow = OverflowPolicyTable{}) noexcept
             : sources(sourcesRange),
-              recorders(recordersRange)
+              recorders(recordersRange),
+              overflowPolicies(overflow),
+              reportFilter(reportPolicies),
+              recorderTasks(makeRecorderTasks(std::make_index_sequence<RECORDER_COUNT>{}))
         {
         }
 
@@ -117,31 +272,361 @@ export namespace BusinessLogic
             return result;
         }
 
+        /**
+         * @brief Samples all routed sources and queues new measurements for their recorders.
+         *
+         * @details
+         * Measurements dropped by the source pipeline or suppressed by its report policy are
+         * not queued. Measurements parked by COALESCE_LATEST in earlier ticks are queued first.
+         *
+         * @return false if a measurement was lost because a recorder queue was full.
+         */
         [[nodiscard]] auto onTick() noexcept -> bool
+        {
+            reportFilter.advance();
+
+            for (std::size_t recorderIndex = 0U; recorderIndex < RECORDER_COUNT; ++recorderIndex)
+            {
+                flushCoalesced(recorderIndex);
+            }
+
+            return sampleSources(std::make_index_sequence<SOURCE_COUNT>{});
+        }
+
+        /**
+         * @brief Passes queued measurements to one recorder as a single batch.
+         *
+         * @details
+         * Drains the measurements queued when the call starts; measurements queued meanwhile
+         * wait for the next call. Nothing is passed if the queue is empty. An out-of-range
+         * index is ignored. A rejected batch is not retried; its measurements are counted as
+         * rejected in getQueueStats().
+         *
+         * @param recorderIndex Position of the recorder in the recorder range.
+         * @return false if the recorder rejected a measurement.
+         */
+        [[nodiscard]] auto drainRecorder(std::size_t recorderIndex) noexcept -> bool
+        {
+            bool status{true};
+
+            if (recorderIndex < RECORDER_COUNT) [[likely]]
+            {
+                auto &queue = queues[recorderIndex];
+                const std::size_t available = queue.size();
+                Device::MeasurementRecord record{};
+
+                batch.clear();
+
+                while ((batch.size() < available) && queue.pop(record))
+                {
+                    static_cast<void>(batch.push(record));
+                }
+
+                const std::size_t count = batch.size();
+
+                if (count != 0U)
+                {
+                    SchedulerTrace::record(TraceEventType::RECORDER_NOTIFY,
+                                           static_cast<std::uint8_t>(recorderIndex),
+                                           static_cast<std::uint16_t>(count));
+
+                    visit_at(recorders,
+                             recorderIndex,
+                             [&](auto &recorder) noexcept
+                             {
+                                 status = Device::notifyBatch(recorder, batch.getColumns());
+                             });
+
+                    if (status)
+                    {
+                        delivered[recorderIndex] += static_cast<std::uint32_t>(count);
+                    }
+                    else
+                    {
+                        rejected[recorderIndex] += static_cast<std::uint32_t>(count);
+                    }
+                }
+            }
+
+            return status;
+        }
+
+        /**
+         * @brief Returns the scheduler task that drains one recorder queue.
+         *
+         * @param recorderIndex Position of the recorder in the recorder range; must be valid.
+         */
+        [[nodiscard]] auto getRecorderTask(std::size_t recorderIndex) noexcept -> RecorderTask &
+        {
+            return recorderTasks[recorderIndex];
+        }
+
+        /**
+         * @brief Returns fill level and loss diagnostics of one recorder queue.
+         *
+         * @param recorderIndex Position of the recorder; out-of-range indices return zeros.
+         */
+        [[nodiscard]] auto getQueueStats(std::size_t recorderIndex) const noexcept -> RecorderQueueStats
+        {
+            RecorderQueueStats result{};
+
+            if (recorderIndex < RECORDER_COUNT) [[likely]]
+            {
+                const auto &queue = queues[recorderIndex];
+
+                result.depth = static_cast<std::uint32_t>(queue.size());
+                result.highWater = queue.getHighWater();
+                result.dropped = queue.getDropped();
+                result.coalesced = coalesceBuffers[recorderIndex].replaced;
+                result.delivered = delivered[recorderIndex];
+                result.rejected = rejected[recorderIndex];
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the measurement tap, e.g. to read the aggregates it collected.
+         */
+        [[nodiscard]] auto getTap() noexcept -> Tap &
+        {
+            return tap;
+        }
+
+        /**
+         * @brief Returns how many measurements of one source the report policy suppressed.
+         */
+        [[nodiscard]] auto getSuppressedCount(Device::MeasurementDeviceId source) const noexcept -> std::uint32_t
+        {
+            return reportFilter.getSuppressed(source);
+        }
+
+    private:
+        /// Queues hold packed records: 16 bytes per entry instead of 24 for a MeasurementType.
+        using Queue = SpscQueue<Device::MeasurementRecord, QueueCapacity>;
+
+        template <std::size_t... SourceIndex>
+        auto sampleSources(std::index_sequence<SourceIndex...>) noexcept -> bool
+        {
+            bool status{true};
+
+            ((status = sampleSource<SourceIndex>() && status), ...);
+
+            return status;
+        }
+
+        template <std::size_t SourceIndex>
+        auto sampleSource() noexcept -> bool
         {
             bool status{true};
 
-            visit_range(sources,
-                        [&](auto &source) noexcept
+            if constexpr (ROUTING.routes[SourceIndex] != 0U)
+            {
+                std::visit(
+                    [&](auto &ref) noexcept
+                    {
+                        auto &source = ref.get();
+
+                        if (source.isMeasurementAvailable())
                         {
-                            if (source.isMeasurementAvailable())
+                            Device::MeasurementType measurement = source.getMeasurement();
+
+                            if (pipelines.template process<SourceIndex>(measurement))
                             {
-                                const auto measurement = source.getMeasurement();
-
-                                visit_range(recorders,
-                                            [&](auto &recorder) noexcept
-                                            {
-                                                status = status &&
-                                                         recorder.notify(measurement);
-                                            });
+                                tap.observe(measurement);
+
+                                if (reportFilter.shouldReport(measurement))
+                                {
+                                    assignSequence(measurement);
+
+                                    status = pushRouted<SourceIndex>(Device::toRecord(measurement),
+                                                                     std::make_index_sequence<RECORDER_COUNT>{});
+                                }
                             }
-                        });
+                        }
+                    },
+                    std::get<SourceIndex>(sources));
+            }
 
             return status;
         }
 
-    private:
+        template <std::size_t SourceIndex, std::size_t... RecorderIndex>
+        auto pushRouted(const Device::MeasurementRecord &record, std::index_sequence<RecorderIndex...>) noexcept
+            -> bool
+        {
+            bool status{true};
+
+            ((status = pushIfRouted<SourceIndex, RecorderIndex>(record) && status), ...);
+
+            return status;
+        }
+
+        template <std::size_t SourceIndex, std::size_t RecorderIndex>
+        auto pushIfRouted(const Device::MeasurementRecord &record) noexcept -> bool
+        {
+            bool status{true};
+
+            if constexpr (ROUTING.isRouted(SourceIndex, RecorderIndex))
+            {
+                status = enqueue(RecorderIndex, record);
+            }
+
+            return status;
+        }
+
+        /**
+         * @brief Newest measurement per source waiting for room in a COALESCE_LATEST queue.
+         */
+        struct CoalesceBuffer final
+        {
+            std::array<Device::MeasurementRecord, MEASUREMENT_SOURCE_COUNT> latest{};
+
+            /// Bit n set: latest[n] holds a measurement.
+            std::uint32_t occupied{0U};
+
+            /// Parked measurements overwritten by a newer one.
+            std::uint32_t replaced{0U};
+        };
+
+        /**
+         * @brief Queues a measurement for one recorder according to its overflow policy.
+         *
+         * @return false if a measurement was lost.
+         */
+        auto enqueue(std::size_t recorderIndex, const Device::MeasurementRecord &record) noexcept -> bool
+        {
+            Queue &queue = queues[recorderIndex];
+            bool status{true};
+
+            switch (overflowPolicies[recorderIndex])
+            {
+            case OverflowPolicy::DROP_OLDEST:
+                status = queue.pushOverwrite(record);
+                break;
+
+            case OverflowPolicy::COALESCE_LATEST:
+                status = coalesce(recorderIndex, record);
+                break;
+
+            case OverflowPolicy::DROP_NEWEST:
+            default:
+                status = queue.push(record);
+                break;
+            }
+
+            return status;
+        }
+
+        /**
+         * @brief Queues a measurement, or parks it as the latest of its source if it cannot be queued yet.
+         *
+         * @details
+         * A parked measurement of the same source means older values are still waiting, so
+         * the new one replaces it instead of overtaking it.
+         *
+         * @return false if a measurement was lost.
+         */
+        auto coalesce(std::size_t recorderIndex, const Device::MeasurementRecord &record) noexcept -> bool
+        {
+            Queue &queue = queues[recorderIndex];
+            CoalesceBuffer &buffer = coalesceBuffers[recorderIndex];
+            const std::size_t sourceIndex = std::to_underlying(record.source);
+            bool status{true};
+
+            if (sourceIndex < MEASUREMENT_SOURCE_COUNT) [[likely]]
+            {
+                const std::uint32_t bit = std::uint32_t{1U} << sourceIndex;
+
+                if (((buffer.occupied & bit) != 0U) || queue.isFull())
+                {
+                    if ((buffer.occupied & bit) != 0U)
+                    {
+                        ++buffer.replaced;
+                    }
+
+                    buffer.latest[sourceIndex] = record;
+                    buffer.occupied |= bit;
+                }
+                else
+                {
+                    status = queue.push(record);
+                }
+            }
+            else
+            {
+                status = queue.push(record);
+            }
+
+            return status;
+        }
+
+        /**
+         * @brief Moves parked measurements into the queue while it has room.
+         */
+        auto flushCoalesced(std::size_t recorderIndex) noexcept -> void
+        {
+            Queue &queue = queues[recorderIndex];
+            CoalesceBuffer &buffer = coalesceBuffers[recorderIndex];
+
+            while ((buffer.occupied != 0U) && !queue.isFull())
+            {
+                const auto sourceIndex = static_cast<std::size_t>(std::countr_zero(buffer.occupied));
+
+                static_cast<void>(queue.push(buffer.latest[sourceIndex]));
+                buffer.occupied &= buffer.occupied - 1U;
+            }
+        }
+
+        /**
+         * @brief Numbers reported measurements per source; wraps at 2^16.
+         */
+        auto assignSequence(Device::MeasurementType &measurement) noexcept -> void
+        {
+            const std::size_t sourceIndex = std::to_underlying(measurement.source);
+
+            if (sourceIndex < MEASUREMENT_SOURCE_COUNT) [[likely]]
+            {
+                measurement.sequence = sequences[sourceIndex]++;
+            }
+        }
+
+        template <std::size_t... Index>
+        constexpr auto makeRecorderTasks(std::index_sequence<Index...>) noexcept
+            -> std::array<RecorderTask, RECORDER_COUNT>
+        {
+            return {RecorderTask{*this, Index}...};
+        }
+
         SourceRange &sources;
         RecorderRange &recorders;
+
+        OverflowPolicyTable overflowPolicies;
+
+        [[no_unique_address]] Pipelines pipelines{};
+
+        [[no_unique_address]] Tap tap{};
+
+        ReportFilter reportFilter;
+
+        /// One queue per recorder, same order as the recorder range.
+        std::array<Queue, RECORDER_COUNT> queues{};
+
+        /// Measurements parked by COALESCE_LATEST, per recorder.
+        std::array<CoalesceBuffer, RECORDER_COUNT> coalesceBuffers{};
+
+        /// Measurements accepted by each recorder.
+        std::array<std::uint32_t, RECORDER_COUNT> delivered{};
+
+        /// Measurements in batches rejected by each recorder.
+        std::array<std::uint32_t, RECORDER_COUNT> rejected{};
+
+        /// Next sequence number per source, indexed by Device::MeasurementDeviceId.
+        std::array<std::uint16_t, MEASUREMENT_SOURCE_COUNT> sequences{};
+
+        /// Batch handed to a recorder; shared because recorders are drained one at a time.
+        Device::MeasurementBatch<QueueCapacity> batch{};
+
+        std::array<RecorderTask, RECORDER_COUNT> recorderTasks;
     };
 }
\ No newline at end of file
@@ -0,0 +1,284 @@
+/**
+ * @file MeasurementPipeline.cppm
+ * @brief Compile-time chains of measurement processing stages.
+ */
+module;
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+export module BusinessLogic.MeasurementPipeline;
+
+import Device.MeasurementType;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief A step applied to a measurement between the source and the recorders.
+     *
+     * @details
+     * process() may rewrite the measurement in place. Returning false drops it; later stages
+     * and the recorders do not see it.
+     */
+    template <typename T>
+    concept PipelineStage = requires(T &stage, Device::MeasurementType &measurement) {
+        { stage.process(measurement) } noexcept -> std::same_as<bool>;
+    };
+
+    /**
+     * @brief Applies fn to the measurement value, keeping the variant alternative.
+     *
+     * @details
+     * fn receives the value widened to 64 bits and its result is clamped to the range of the
+     * original alternative.
+     */
+    template <typename Fn>
+    constexpr auto transformValue(Device::MeasurementType::DataVariant &data, Fn &&fn) noexcept -> void
+    {
+        data = std::visit(
+            [&](auto value) noexcept -> Device::MeasurementType::DataVariant
+            {
+                using Value = decltype(value);
+
+                const std::uint64_t result = fn(static_cast<std::uint64_t>(value));
+                const std::uint64_t limit = std::numeric_limits<Value>::max();
+
+                return Device::MeasurementType::DataVariant{std::in_place_type<Value>,
+                                                            static_cast<Value>(std::min(result, limit))};
+            },
+            data);
+    }
+
+    /// @brief Returns the measurement value widened to 32 bits.
+    [[nodiscard]] constexpr auto valueOf(const Device::MeasurementType::DataVariant &data) noexcept -> std::uint32_t
+    {
+        return std::visit([](auto value) noexcept -> std::uint32_t
+                          { return static_cast<std::uint32_t>(value); },
+                          data);
+    }
+
+    /**
+     * @brief Multiplies the value by Numerator / Denominator.
+     *
+     * @details
+     * Used for scaling and unit conversion, e.g. ScaleStage<200U, 1U> turns counts per 5 ms
+     * slot into counts per second. Rounds towards zero and saturates at the maximum of the
+     * value type.
+     */
+    template <std::uint32_t Numerator, std::uint32_t Denominator>
+    class ScaleStage final
+    {
+    public:
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &measurement) noexcept -> bool
+        {
+            transformValue(measurement.data,
+                           [](std::uint64_t value) noexcept -> std::uint64_t
+                           { return (value * Numerator) / Denominator; });
+
+            return true;
+        }
+
+    private:
+        static_assert(Denominator != 0U, "ScaleStage denominator must not be zero.");
+    };
+
+    /**
+     * @brief Passes one measurement out of every Factor.
+     *
+     * @details
+     * The first measurement passes, so a decimated source reports right after start.
+     */
+    template <std::uint32_t Factor>
+    class DecimateStage final
+    {
+    public:
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &) noexcept -> bool
+        {
+            const bool result = (count == 0U);
+
+            count = (count + 1U == Factor) ? 0U : (count + 1U);
+
+            return result;
+        }
+
+    private:
+        std::uint32_t count{0U};
+
+        static_assert(Factor != 0U, "DecimateStage factor must not be zero.");
+    };
+
+    /**
+     * @brief Replaces the value by the mean of the last Window values.
+     *
+     * @details
+     * Keeps a running sum, so the cost does not depend on Window. Until Window values were
+     * seen the mean covers only the values seen so far.
+     */
+    template <std::size_t Window>
+    class MovingAverageStage final
+    {
+    public:
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &measurement) noexcept -> bool
+        {
+            const std::uint32_t value = valueOf(measurement.data);
+
+            sum = sum - history[position] + value;
+            history[position] = value;
+            position = (position + 1U) & (Window - 1U);
+            filled = std::min(filled + 1U, Window);
+
+            const std::uint64_t mean = sum / filled;
+
+            transformValue(measurement.data,
+                           [mean](std::uint64_t) noexcept -> std::uint64_t
+                           { return mean; });
+
+            return true;
+        }
+
+    private:
+        std::array<std::uint32_t, Window> history{};
+        std::uint64_t sum{0U};
+        std::size_t position{0U};
+        std::size_t filled{0U};
+
+        static_assert((Window != 0U) && ((Window & (Window - 1U)) == 0U),
+                      "MovingAverageStage window must be a power of two so the index wrap is a mask.");
+    };
+
+    /**
+     * @brief Drops values within Band of the last passed value.
+     *
+     * @details
+     * Unlike ReportFilter this runs inside the chain, so it can act on the output of an
+     * earlier stage (e.g. suppress jitter of a moving average). The first value passes.
+     */
+    template <std::uint32_t Band>
+    class DeadbandStage final
+    {
+    public:
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &measurement) noexcept -> bool
+        {
+            const std::uint32_t value = valueOf(measurement.data);
+            const std::uint32_t change = (value > last) ? (value - last) : (last - value);
+            const bool result = !seen || (change > Band);
+
+            if (result)
+            {
+                last = value;
+                seen = true;
+            }
+
+            return result;
+        }
+
+    private:
+        std::uint32_t last{0U};
+        bool seen{false};
+    };
+
+    /**
+     * @brief Chain of stages applied in order to the measurements of one source.
+     *
+     * @details
+     * Stages are members, so they are allocated with the owner and keep their state between
+     * measurements. The chain stops at the first stage that drops the measurement. An empty
+     * Pipeline<> passes everything and takes no storage.
+     */
+    template <PipelineStage... Stages>
+    class Pipeline final
+    {
+    public:
+        /// @brief Number of stages in the chain.
+        static constexpr std::size_t STAGE_COUNT = sizeof...(Stages);
+
+        /**
+         * @brief Runs the measurement through all stages.
+         *
+         * @return false if a stage dropped the measurement.
+         */
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &measurement) noexcept -> bool
+        {
+            return std::apply([&](Stages &...stage) noexcept -> bool
+                              { return (stage.process(measurement) && ...); },
+                              stages);
+        }
+
+        /// @brief Returns one stage, e.g. to inspect its state.
+        template <std::size_t Index>
+        [[nodiscard]] constexpr auto getStage() noexcept -> auto &
+        {
+            return std::get<Index>(stages);
+        }
+
+    private:
+        [[no_unique_address]] std::tuple<Stages...> stages{};
+    };
+
+    /**
+     * @brief One pipeline per source, in source range order.
+     *
+     * @details
+     * Sources past the end of the list have no stages. PipelineSet<> is the default of
+     * MeasurementCoordinator and compiles to nothing.
+     */
+    template <typename... SourcePipelines>
+    class PipelineSet final
+    {
+    public:
+        /// @brief Number of sources with a pipeline of their own.
+        static constexpr std::size_t PIPELINE_COUNT = sizeof...(SourcePipelines);
+
+        /**
+         * @brief Runs a measurement through the pipeline of one source.
+         *
+         * @tparam SourceIndex Position of the source in the source range.
+         * @return false if the measurement was dropped.
+         */
+        template <std::size_t SourceIndex>
+        [[nodiscard]] constexpr auto process(Device::MeasurementType &measurement) noexcept -> bool
+        {
+            bool result{true};
+
+            if constexpr (SourceIndex < PIPELINE_COUNT)
+            {
+                result = std::get<SourceIndex>(pipelines).process(measurement);
+            }
+
+            return result;
+        }
+
+    private:
+        [[no_unique_address]] std::tuple<SourcePipelines...> pipelines{};
+    };
+
+    /**
+     * @brief Observer of every measurement that left its pipeline.
+     *
+     * @details
+     * The tap sees the measurements before report-by-exception filtering, so aggregates
+     * (e.g. RollupAggregator) include the suppressed values.
+     */
+    template <typename T>
+    concept MeasurementTap = requires(T &tap, const Device::MeasurementType &measurement) {
+        { tap.observe(measurement) } noexcept -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Tap that ignores all measurements; default of MeasurementCoordinator.
+     */
+    class NoTap final
+    {
+    public:
+        constexpr auto observe(const Device::MeasurementType &) noexcept -> void
+        {
+        }
+    };
+} // namespace BusinessLogic
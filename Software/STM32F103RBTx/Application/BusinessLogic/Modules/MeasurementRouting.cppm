@@ -0,0 +1,90 @@
+/**
+ * @file MeasurementRouting.cppm
+ * @brief Compile-time routing of measurement sources to recorders.
+ */
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+export module BusinessLogic.MeasurementRouting;
+
+export namespace BusinessLogic
+{
+    /// @brief Set of recorders, bit n selects the recorder at position n of the recorder range.
+    using RecorderMask = std::uint32_t;
+
+    /// @brief Largest number of recorders a RecorderMask can address.
+    inline constexpr std::size_t MAX_ROUTED_RECORDERS{sizeof(RecorderMask) * 8U};
+
+    /**
+     * @brief Returns the mask selecting one recorder.
+     *
+     * @param recorderIndex Position of the recorder in the recorder range.
+     */
+    [[nodiscard]] constexpr auto recorderBit(std::size_t recorderIndex) noexcept -> RecorderMask
+    {
+        return RecorderMask{1U} << recorderIndex;
+    }
+
+    /**
+     * @brief Source × recorder routing matrix.
+     *
+     * @tparam SourceCount   Number of sources in the source range.
+     * @tparam RecorderCount Number of recorders in the recorder range.
+     *
+     * @details
+     * Row n holds the recorders that receive the measurements of the source at position n of
+     * the source range. The table is a structural type, so it can be passed as a template
+     * argument and MeasurementCoordinator can expand every routed pair at compile time.
+     */
+    template <std::size_t SourceCount, std::size_t RecorderCount>
+    struct RoutingTable final
+    {
+        static_assert(RecorderCount <= MAX_ROUTED_RECORDERS,
+                      "RoutingTable supports at most one recorder per RecorderMask bit.");
+
+        /// @brief Mask with every recorder selected.
+        static constexpr RecorderMask ALL_RECORDERS{
+            (RecorderCount == MAX_ROUTED_RECORDERS) ? ~RecorderMask{0U}
+                                                    : (recorderBit(RecorderCount) - 1U)};
+
+        /// @brief Recorders per source, indexed by source position.
+        std::array<RecorderMask, SourceCount> routes{};
+
+        /**
+         * @brief Returns a table that routes every source to every recorder.
+         */
+        [[nodiscard]] static constexpr auto all() noexcept -> RoutingTable
+        {
+            RoutingTable result{};
+            result.routes.fill(ALL_RECORDERS);
+
+            return result;
+        }
+
+        /**
+         * @brief Checks whether one source is routed to one recorder.
+         */
+        [[nodiscard]] constexpr auto isRouted(std::size_t sourceIndex, std::size_t recorderIndex) const noexcept -> bool
+        {
+            return (routes[sourceIndex] & recorderBit(recorderIndex)) != 0U;
+        }
+
+        /**
+         * @brief Checks that no route names a recorder outside the recorder range.
+         */
+        [[nodiscard]] constexpr auto isValid() const noexcept -> bool
+        {
+            bool result = true;
+
+            for (const RecorderMask mask : routes)
+            {
+                result = result && ((mask & ~ALL_RECORDERS) == 0U);
+            }
+
+            return result;
+        }
+    };
+} // namespace BusinessLogic
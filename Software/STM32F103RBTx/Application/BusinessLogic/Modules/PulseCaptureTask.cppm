@@ -0,0 +1,178 @@
+/**
+ * @file PulseCaptureTask.cppm
+ * @brief Drains the pulse capture ring into an inter-arrival histogram.
+ */
+module;
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module BusinessLogic.PulseCaptureTask;
+
+import Device;
+
+import Driver.CoreClockConfig;
+import Driver.CycleClock;
+import Driver.CycleCpu;
+import Driver.PulseCapture;
+
+export namespace BusinessLogic
+{
+    /**
+     * @concept PulseCaptureDriver
+     * @brief Capture part of a pulse counter driver (see Driver::PulseCounterDriver).
+     */
+    template <typename T>
+    concept PulseCaptureDriver = requires(T driver, std::span<Driver::CaptureTick> ticks) {
+        { driver.startCapture(std::uint32_t{}) } noexcept -> std::same_as<bool>;
+        { driver.stopCapture() } noexcept -> std::same_as<void>;
+        { driver.readCaptures(ticks) } noexcept -> std::same_as<std::size_t>;
+        { driver.getLostCaptures() } noexcept -> std::same_as<std::uint32_t>;
+    };
+
+    /**
+     * @brief Periodic task turning the capture ticks of one pulse input into a histogram.
+     *
+     * @tparam CaptureDriver Driver of the captured input.
+     *
+     * @details
+     * tick() must run more often than the driver ring fills: CAPTURE_CAPACITY ticks take
+     * 10 ms at 100 k pulses/s, against a 5 ms slot. Each call empties the ring in chunks
+     * and adds the intervals to the histogram.
+     *
+     * A 16-bit tick cannot tell an interval from the same interval plus whole timer periods.
+     * When a tick() finds no ticks at least one timer period after the last tick() that
+     * found some, the next interval is certainly longer than a period and goes to the
+     * overflow bin. Quieter gaps that are still longer than a period are not detected, so
+     * tick() should run well within one timer period (65.5 ms at 1 MHz).
+     *
+     * Ticks lost in the driver restart the interval chain.
+     */
+    template <PulseCaptureDriver CaptureDriver>
+    class PulseCaptureTask final
+    {
+    public:
+        /// Ticks read from the driver at once.
+        static constexpr std::size_t CHUNK_SIZE{128U};
+
+        /// Enough chunks to empty a full ring plus what arrives meanwhile.
+        static constexpr std::size_t MAX_CHUNKS_PER_TICK{(Driver::CAPTURE_CAPACITY / CHUNK_SIZE) + 1U};
+
+        explicit constexpr PulseCaptureTask(CaptureDriver &driver) noexcept
+            : driver(driver)
+        {
+        }
+
+        ~PulseCaptureTask() = default;
+
+        PulseCaptureTask() = delete;
+        PulseCaptureTask(const PulseCaptureTask &) = delete;
+        PulseCaptureTask &operator=(const PulseCaptureTask &) = delete;
+        PulseCaptureTask(PulseCaptureTask &&) = delete;
+        PulseCaptureTask &operator=(PulseCaptureTask &&) = delete;
+
+        /**
+         * @brief Starts the capture with an empty histogram.
+         * @param tickHz Capture timer rate.
+         * @return false if the driver cannot capture at this rate.
+         */
+        [[nodiscard]] auto start(std::uint32_t tickHz) noexcept -> bool
+        {
+            const bool status = driver.startCapture(tickHz);
+
+            if (status)
+            {
+                histogram.clear();
+                periodCycles = static_cast<Driver::CycleTimestamp>(Driver::CAPTURE_TICK_RANGE) * (Driver::coreHz / tickHz);
+                lostSeen = 0U;
+                hasCaptured = false;
+                quietCycles = 0U;
+            }
+
+            return status;
+        }
+
+        auto stop() noexcept -> void
+        {
+            driver.stopCapture();
+        }
+
+        /**
+         * @brief Drains the driver ring.
+         * @return false if ticks were lost in the driver since the previous call.
+         */
+        [[nodiscard]] auto tick() noexcept -> bool
+        {
+            const Driver::CycleTimestamp now = Driver::CycleClock::timestamp();
+            const std::uint32_t lostBefore = lostSeen;
+            std::size_t drained{0U};
+            std::size_t count{0U};
+            std::size_t chunks{0U};
+
+            do
+            {
+                count = driver.readCaptures(chunk);
+
+                const std::uint32_t lost = driver.getLostCaptures();
+
+                if (lost != lostSeen) [[unlikely]]
+                {
+                    histogram.restart();
+                    lostSeen = lost;
+                }
+
+                if ((count != 0U) && (drained == 0U) && (quietCycles >= periodCycles))
+                {
+                    histogram.markLongGap();
+                }
+
+                const std::span<const Driver::CaptureTick> ticks = std::span{chunk}.first(count);
+
+                histogram.add(ticks);
+
+                drained += count;
+                ++chunks;
+            } while ((count == CHUNK_SIZE) && (chunks < MAX_CHUNKS_PER_TICK));
+
+            if (drained != 0U)
+            {
+                lastCaptured = now;
+                hasCaptured = true;
+                quietCycles = 0U;
+            }
+            else if (hasCaptured)
+            {
+                // The next tick arrives after now, the previous one did before lastCaptured.
+                quietCycles = now - lastCaptured;
+            }
+
+            return lostSeen == lostBefore;
+        }
+
+        [[nodiscard]] auto getHistogram() const noexcept -> const Device::InterArrivalHistogram &
+        {
+            return histogram;
+        }
+
+    private:
+        CaptureDriver &driver;
+        Device::InterArrivalHistogram histogram{};
+        std::array<Driver::CaptureTick, CHUNK_SIZE> chunk{};
+
+        /// Capture timer period, in core cycles.
+        Driver::CycleTimestamp periodCycles{0U};
+
+        /// Time of the last tick() that drained captures.
+        Driver::CycleTimestamp lastCaptured{0U};
+        bool hasCaptured{false};
+
+        /// Lower bound of the time since the last drained tick, from tick() calls that found none.
+        Driver::CycleTimestamp quietCycles{0U};
+
+        std::uint32_t lostSeen{0U};
+    };
+
+} // namespace BusinessLogic
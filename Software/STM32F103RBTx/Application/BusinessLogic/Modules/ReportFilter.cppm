@@ -0,0 +1,169 @@
+/**
+ * @file ReportFilter.cppm
+ * @brief Report-by-exception filtering of measurements per source.
+ */
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <variant>
+
+export module BusinessLogic.ReportFilter;
+
+import Device;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief When a source passes its measurements on to the recorders.
+     */
+    enum class ReportMode : std::uint8_t
+    {
+        /// @brief Every measurement is reported.
+        ALWAYS = 0,
+
+        /// @brief Only measurements that moved out of the deadband (plus heartbeats) are reported.
+        ON_CHANGE
+    };
+
+    /**
+     * @brief Report-by-exception settings of one measurement source.
+     */
+    struct ReportPolicy final
+    {
+        /// @brief Reporting mode; ALWAYS ignores the other fields.
+        ReportMode mode{ReportMode::ALWAYS};
+
+        /**
+         * @brief Largest change that is still treated as "unchanged".
+         *
+         * @details
+         * A measurement is reported when it differs from the last reported value by more than
+         * deadband. Zero reports every change.
+         */
+        std::uint32_t deadband{0U};
+
+        /**
+         * @brief Coordinator ticks after which an unchanged value is reported again.
+         *
+         * @details
+         * Lets consumers tell an unchanged channel from a dead one. Zero disables heartbeats.
+         */
+        std::uint32_t heartbeatTicks{0U};
+    };
+
+    /// @brief Number of measurement sources, one policy each.
+    inline constexpr std::size_t MEASUREMENT_SOURCE_COUNT{
+        std::to_underlying(Device::MeasurementDeviceId::LAST_NOT_USED)};
+
+    /// @brief Policies indexed by Device::MeasurementDeviceId; all ALWAYS by default.
+    using ReportPolicyTable = std::array<ReportPolicy, MEASUREMENT_SOURCE_COUNT>;
+
+    /// @brief Reports every measurement of every source.
+    inline constexpr ReportPolicyTable REPORT_ALWAYS{};
+
+    /**
+     * @brief Decides per measurement whether it is worth reporting.
+     *
+     * @details
+     * Keeps the last reported value and the tick it was reported at for every source.
+     * The first measurement of a source is always reported.
+     */
+    class ReportFilter final
+    {
+    public:
+        explicit constexpr ReportFilter(const ReportPolicyTable &policyTable) noexcept
+            : policies(policyTable)
+        {
+        }
+
+        /**
+         * @brief Advances the heartbeat time base by one coordinator tick.
+         */
+        constexpr auto advance() noexcept -> void
+        {
+            ++tick;
+        }
+
+        /**
+         * @brief Checks a new measurement against its source policy.
+         *
+         * @details
+         * Updates the last reported value when the measurement passes. Measurements with an
+         * unknown source are always reported.
+         *
+         * @return True if the measurement should be passed to the recorders.
+         */
+        [[nodiscard]] constexpr auto shouldReport(const Device::MeasurementType &measurement) noexcept -> bool
+        {
+            const std::size_t index = std::to_underlying(measurement.source);
+            bool result = true;
+
+            if (index < MEASUREMENT_SOURCE_COUNT) [[likely]]
+            {
+                const ReportPolicy &policy = policies[index];
+                SourceState &state = states[index];
+                const std::uint32_t value = toValue(measurement.data);
+
+                if ((policy.mode == ReportMode::ON_CHANGE) && state.reported)
+                {
+                    const std::uint32_t change = (value > state.value) ? (value - state.value)
+                                                                       : (state.value - value);
+
+                    const bool heartbeatDue = (policy.heartbeatTicks != 0U) &&
+                                              ((tick - state.tick) >= policy.heartbeatTicks);
+
+                    result = (change > policy.deadband) || heartbeatDue;
+                }
+
+                if (result)
+                {
+                    state.value = value;
+                    state.tick = tick;
+                    state.reported = true;
+                }
+                else
+                {
+                    ++state.suppressed;
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the number of measurements of one source that were not reported.
+         */
+        [[nodiscard]] constexpr auto getSuppressed(Device::MeasurementDeviceId source) const noexcept -> std::uint32_t
+        {
+            const std::size_t index = std::to_underlying(source);
+
+            return (index < MEASUREMENT_SOURCE_COUNT) ? states[index].suppressed : 0U;
+        }
+
+    private:
+        struct SourceState final
+        {
+            std::uint32_t value{0U};
+            std::uint32_t tick{0U};
+            std::uint32_t suppressed{0U};
+            bool reported{false};
+        };
+
+        [[nodiscard]] static constexpr auto toValue(const Device::MeasurementType::DataVariant &data) noexcept
+            -> std::uint32_t
+        {
+            return std::visit([](auto value) constexpr noexcept -> std::uint32_t
+                              { return static_cast<std::uint32_t>(value); },
+                              data);
+        }
+
+        const ReportPolicyTable &policies;
+        std::array<SourceState, MEASUREMENT_SOURCE_COUNT> states{};
+
+        /// Coordinator ticks since start; wraps, differences stay valid.
+        std::uint32_t tick{0U};
+    };
+} // namespace BusinessLogic
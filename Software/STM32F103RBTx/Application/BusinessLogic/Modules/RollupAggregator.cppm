@@ -0,0 +1,247 @@
+/**
+ * @file RollupAggregator.cppm
+ * @brief Incremental 1 s / 1 min / 1 h min-max-sum-count rollups per measurement source.
+ */
+module;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+
+export module BusinessLogic.RollupAggregator;
+
+import BusinessLogic.MeasurementPipeline;
+import BusinessLogic.ReportFilter;
+import BusinessLogic.SpscQueue;
+
+import Device;
+
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+
+export namespace BusinessLogic
+{
+    /// @brief Number of rollup tiers.
+    inline constexpr std::size_t ROLLUP_TIER_COUNT{std::to_underlying(Device::RollupTier::LAST_NOT_USED)};
+
+    /**
+     * @brief Keeps running rollups of every source and emits them when their window ends.
+     *
+     * @tparam OutputCapacity Closed rollups buffered until flush(); must be a power of two.
+     *
+     * @details
+     * Used as the MeasurementTap of MeasurementCoordinator, so it sees every measurement,
+     * including the ones the report policy keeps off the recorders. A measurement only updates
+     * the 1 s accumulator of its source. When a window ends, each tier is merged into the next
+     * one before it is cleared, so the memory is one accumulator per source and tier, whatever
+     * the number of measurements. Windows are aligned to the first measurement and end on the
+     * first measurement at or after their end.
+     *
+     * flush() runs in the recorder task and hands the closed rollups to a recorder with
+     * writeRollups() (see Device::SdCardRecorder). Rollups that do not fit the output buffer
+     * are counted and lost; rollups the recorder does not accept are kept and handed over again.
+     */
+    template <std::size_t OutputCapacity = 32U>
+    class RollupAggregator final
+    {
+    public:
+        /// @brief Window length per tier, in milliseconds.
+        static constexpr std::array<std::uint32_t, ROLLUP_TIER_COUNT> TIER_PERIOD_MS{1'000U, 60'000U, 3'600'000U};
+
+        /// @brief Rollups handed to the recorder per flush(); one tier of every source.
+        static constexpr std::size_t FLUSH_BATCH{MEASUREMENT_SOURCE_COUNT};
+
+        /**
+         * @brief Adds one measurement to the 1 s rollup of its source.
+         */
+        auto observe(const Device::MeasurementType &measurement) noexcept -> void
+        {
+            const std::size_t sourceIndex = std::to_underlying(measurement.source);
+
+            if (!started) [[unlikely]]
+            {
+                start(measurement.timestamp);
+            }
+
+            if (measurement.timestamp >= windowEnds[0]) [[unlikely]]
+            {
+                closeWindows(measurement.timestamp);
+            }
+
+            if (sourceIndex < MEASUREMENT_SOURCE_COUNT) [[likely]]
+            {
+                accumulators[0][sourceIndex].add(valueOf(measurement.data));
+            }
+        }
+
+        /**
+         * @brief Writes closed rollups to a recorder.
+         *
+         * @details
+         * Hands over up to FLUSH_BATCH rollups per call; the rest follow on the next calls. The
+         * rollups passed stay valid until the next call, so the recorder may write them later.
+         * If the recorder does not accept them, the same rollups are handed over again on the
+         * next call, before any newer ones.
+         *
+         * @return false if the recorder did not accept the rollups.
+         */
+        template <typename Recorder>
+        [[nodiscard]] auto flush(Recorder &recorder) noexcept -> bool
+        {
+            bool status{true};
+
+            while ((batchCount < batch.size()) && output.pop(batch[batchCount]))
+            {
+                ++batchCount;
+            }
+
+            if (batchCount != 0U)
+            {
+                status = recorder.writeRollups(std::span<const Device::MeasurementRollup>{batch}.first(batchCount));
+
+                if (status) [[likely]]
+                {
+                    batchCount = 0U;
+                }
+                else
+                {
+                    ++failedFlushes;
+                }
+            }
+
+            return status;
+        }
+
+        /// @brief Closed rollups lost because the output buffer was full.
+        [[nodiscard]] auto getDropped() const noexcept -> std::uint32_t
+        {
+            return output.getDropped();
+        }
+
+        /// @brief flush() calls whose rollups the recorder did not accept.
+        [[nodiscard]] auto getFailedFlushes() const noexcept -> std::uint32_t
+        {
+            return failedFlushes;
+        }
+
+    private:
+        /// Running rollup of one source in one tier.
+        struct Accumulator final
+        {
+            std::uint64_t sum{0U};
+            std::uint32_t count{0U};
+            std::uint32_t min{std::numeric_limits<std::uint32_t>::max()};
+            std::uint32_t max{0U};
+
+            constexpr auto add(std::uint32_t value) noexcept -> void
+            {
+                sum += value;
+                ++count;
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+
+            constexpr auto merge(const Accumulator &other) noexcept -> void
+            {
+                sum += other.sum;
+                count += other.count;
+                min = std::min(min, other.min);
+                max = std::max(max, other.max);
+            }
+        };
+
+        static constexpr auto toCycles(std::uint32_t ms) noexcept -> Driver::CycleTimestamp
+        {
+            return static_cast<Driver::CycleTimestamp>(ms) * (Driver::coreHz / 1'000U);
+        }
+
+        auto start(Driver::CycleTimestamp now) noexcept -> void
+        {
+            for (std::size_t tier = 0U; tier < ROLLUP_TIER_COUNT; ++tier)
+            {
+                windowStarts[tier] = now;
+                windowEnds[tier] = now + toCycles(TIER_PERIOD_MS[tier]);
+            }
+
+            started = true;
+        }
+
+        /**
+         * @brief Closes the 1 s window and every coarser window that ended by @p now.
+         */
+        auto closeWindows(Driver::CycleTimestamp now) noexcept -> void
+        {
+            std::size_t tier{0U};
+            bool closing{true};
+
+            while (closing)
+            {
+                closeTier(tier, now);
+                ++tier;
+                closing = (tier < ROLLUP_TIER_COUNT) && (now >= windowEnds[tier]);
+            }
+        }
+
+        /**
+         * @brief Emits the rollups of one tier, merges them into the next tier and starts the
+         *        window that contains @p now.
+         */
+        auto closeTier(std::size_t tier, Driver::CycleTimestamp now) noexcept -> void
+        {
+            for (std::size_t sourceIndex = 0U; sourceIndex < MEASUREMENT_SOURCE_COUNT; ++sourceIndex)
+            {
+                Accumulator &accumulator = accumulators[tier][sourceIndex];
+
+                if (accumulator.count != 0U)
+                {
+                    static_cast<void>(output.push(Device::MeasurementRollup{
+                        .source = static_cast<Device::MeasurementDeviceId>(sourceIndex),
+                        .tier = static_cast<Device::RollupTier>(tier),
+                        .count = accumulator.count,
+                        .min = accumulator.min,
+                        .max = accumulator.max,
+                        .sum = accumulator.sum,
+                        .start = windowStarts[tier]}));
+
+                    if ((tier + 1U) < ROLLUP_TIER_COUNT)
+                    {
+                        accumulators[tier + 1U][sourceIndex].merge(accumulator);
+                    }
+
+                    accumulator = Accumulator{};
+                }
+            }
+
+            // Windows without measurements (a stopped source, a long gap) are skipped.
+            const Driver::CycleTimestamp period = toCycles(TIER_PERIOD_MS[tier]);
+            const Driver::CycleTimestamp skipped = (now - windowEnds[tier]) / period;
+
+            windowStarts[tier] = windowEnds[tier] + (skipped * period);
+            windowEnds[tier] = windowStarts[tier] + period;
+        }
+
+        std::array<std::array<Accumulator, MEASUREMENT_SOURCE_COUNT>, ROLLUP_TIER_COUNT> accumulators{};
+        std::array<Driver::CycleTimestamp, ROLLUP_TIER_COUNT> windowStarts{};
+        std::array<Driver::CycleTimestamp, ROLLUP_TIER_COUNT> windowEnds{};
+        bool started{false};
+
+        SpscQueue<Device::MeasurementRollup, OutputCapacity> output{};
+
+        /// Rollups popped by flush(); a member to keep them off the 1 KiB stack.
+        std::array<Device::MeasurementRollup, FLUSH_BATCH> batch{};
+
+        /// Rollups in batch not accepted by the recorder yet.
+        std::size_t batchCount{0U};
+
+        std::uint32_t failedFlushes{0U};
+
+        static_assert((TIER_PERIOD_MS[1] % TIER_PERIOD_MS[0] == 0U) && (TIER_PERIOD_MS[2] % TIER_PERIOD_MS[1] == 0U),
+                      "Each rollup tier must be a multiple of the finer one so the windows stay aligned.");
+    };
+
+    static_assert(MeasurementTap<RollupAggregator<>>, "RollupAggregator must satisfy MeasurementTap concept");
+} // namespace BusinessLogic
@@ -0,0 +1,382 @@
+/**
+ * @file SchedulerProfiler.cppm
+ * @brief Optional cycle profiling policies for SlotTableScheduler.
+ */
+module;
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+export module BusinessLogic.SchedulerProfiler;
+
+import BusinessLogic.TaskId;
+
+import Driver.CycleCpu;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief Requirements for a SlotTableScheduler profiling policy.
+     *
+     * @details
+     * The scheduler calls recordTask() after every executed task and recordSlot() after every
+     * executed slot, passing the elapsed CycleClock cycles. When ENABLED is false the scheduler
+     * does not read the cycle counter around individual tasks, so a disabled policy adds no
+     * runtime cost.
+     */
+    template <typename T>
+    concept SchedulerProfilingPolicy =
+        std::default_initializable<T> &&
+        requires(T policy, TaskId taskId, std::size_t slot, Driver::CycleCpu cycles) {
+            { T::ENABLED } -> std::convertible_to<bool>;
+            { policy.recordTask(taskId, cycles) } noexcept -> std::same_as<void>;
+            { policy.recordSlot(slot, cycles) } noexcept -> std::same_as<void>;
+            { policy.reset() } noexcept -> std::same_as<void>;
+        };
+
+    /**
+     * @brief Default profiling policy: records nothing.
+     */
+    struct NoProfiling final
+    {
+        static constexpr bool ENABLED{false};
+
+        constexpr auto recordTask(TaskId, Driver::CycleCpu) noexcept -> void {}
+        constexpr auto recordSlot(std::size_t, Driver::CycleCpu) noexcept -> void {}
+        constexpr auto reset() noexcept -> void {}
+    };
+
+    /**
+     * @brief Min/max/mean and log2 histogram of cycle samples.
+     *
+     * @details
+     * Histogram bucket b holds samples whose std::bit_width() equals b, so bucket 0 holds
+     * zero, bucket 1 holds 1, bucket 2 holds [2, 3], bucket 3 holds [4, 7] and so on.
+     * The histogram gives a coarse tail estimate (e.g. p99) without storing samples.
+     */
+    struct CycleStats final
+    {
+        /// @brief One bucket per possible bit width of a CycleCpu value (0..32).
+        static constexpr std::size_t HISTOGRAM_BUCKETS{
+            static_cast<std::size_t>(std::numeric_limits<Driver::CycleCpu>::digits) + 1U};
+
+        /// @brief Number of recorded samples.
+        std::uint32_t count{0U};
+
+        /// @brief Smallest recorded sample (max CycleCpu while count is zero).
+        Driver::CycleCpu min{std::numeric_limits<Driver::CycleCpu>::max()};
+
+        /// @brief Largest recorded sample.
+        Driver::CycleCpu max{0U};
+
+        /// @brief Sum of all samples, 64-bit so it does not wrap in the field.
+        std::uint64_t sum{0U};
+
+        /// @brief Sample count per log2 bucket.
+        std::array<std::uint32_t, HISTOGRAM_BUCKETS> histogram{};
+
+        /**
+         * @brief Adds one sample.
+         * @param cycles Elapsed cycles of the measured section.
+         */
+        constexpr auto record(Driver::CycleCpu cycles) noexcept -> void
+        {
+            ++count;
+            sum += cycles;
+
+            if (cycles < min)
+            {
+                min = cycles;
+            }
+
+            if (cycles > max)
+            {
+                max = cycles;
+            }
+
+            ++histogram[bucketOf(cycles)];
+        }
+
+        /**
+         * @brief Returns the arithmetic mean of all samples (0 if there are none).
+         */
+        [[nodiscard]] constexpr auto mean() const noexcept -> Driver::CycleCpu
+        {
+            Driver::CycleCpu result = 0U;
+
+            if (count != 0U)
+            {
+                result = static_cast<Driver::CycleCpu>(sum / count);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns an upper bound of the given percentile.
+         *
+         * @details
+         * Walks the histogram until the cumulative count reaches the requested rank and returns
+         * the upper edge of that bucket, clamped to the observed maximum. The result is never
+         * lower than the true percentile.
+         *
+         * @param percent Percentile in [0, 100], e.g. 99 for p99.
+         * @return Upper bound in cycles, or 0 if no samples were recorded.
+         */
+        [[nodiscard]] constexpr auto percentile(std::uint8_t percent) const noexcept -> Driver::CycleCpu
+        {
+            Driver::CycleCpu result = 0U;
+
+            if (count != 0U)
+            {
+                const std::uint64_t clampedPercent = (percent < 100U) ? percent : 100U;
+                const std::uint64_t rank = ((static_cast<std::uint64_t>(count) * clampedPercent) + 99U) / 100U;
+                const std::uint64_t target = (rank == 0U) ? 1U : rank;
+
+                std::uint64_t cumulative = 0U;
+                std::size_t bucket = 0U;
+
+                while ((bucket < HISTOGRAM_BUCKETS) && (cumulative < target))
+                {
+                    cumulative += histogram[bucket];
+                    ++bucket;
+                }
+
+                const Driver::CycleCpu upper = bucketUpperBound(bucket - 1U);
+                result = (upper < max) ? upper : max;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the histogram bucket of a sample.
+         */
+        [[nodiscard]] static constexpr auto bucketOf(Driver::CycleCpu cycles) noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::bit_width(cycles));
+        }
+
+        /**
+         * @brief Returns the largest sample value that falls into a bucket.
+         */
+        [[nodiscard]] static constexpr auto bucketUpperBound(std::size_t bucket) noexcept -> Driver::CycleCpu
+        {
+            constexpr std::size_t DIGITS = static_cast<std::size_t>(std::numeric_limits<Driver::CycleCpu>::digits);
+
+            Driver::CycleCpu result = std::numeric_limits<Driver::CycleCpu>::max();
+
+            if (bucket < DIGITS)
+            {
+                result = static_cast<Driver::CycleCpu>((Driver::CycleCpu{1U} << bucket) - 1U);
+            }
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief Per-task and per-slot profiling counters.
+     *
+     * @tparam SlotsPerCycle Number of slots in one scheduler cycle.
+     * @tparam TaskCount     Number of TaskId values.
+     */
+    template <std::size_t SlotsPerCycle, std::size_t TaskCount>
+    struct ProfileSnapshot final
+    {
+        /// @brief Per-task statistics indexed by std::to_underlying(TaskId).
+        std::array<CycleStats, TaskCount> tasks{};
+
+        /// @brief Per-slot statistics indexed by slot index.
+        std::array<CycleStats, SlotsPerCycle> slots{};
+    };
+
+    /**
+     * @brief Profiling policy recording cycle statistics per TaskId and per slot.
+     *
+     * @tparam SlotsPerCycle Must match the SlotsPerCycle of the scheduler using it.
+     *
+     * @details
+     * All recording happens in runPending() (main loop context), so reading a snapshot from
+     * the main loop is consistent without locking.
+     */
+    template <std::size_t SlotsPerCycle>
+    class CycleProfiler final
+    {
+    public:
+        static constexpr bool ENABLED{true};
+
+        /// @brief Number of profiled tasks, derived from TaskId::LAST_NOT_USED.
+        static constexpr std::size_t TASK_COUNT = std::to_underlying(TaskId::LAST_NOT_USED);
+
+        using Snapshot = ProfileSnapshot<SlotsPerCycle, TASK_COUNT>;
+
+        constexpr auto recordTask(TaskId taskId, Driver::CycleCpu cycles) noexcept -> void
+        {
+            const std::size_t taskIdx = std::to_underlying(taskId);
+
+            if (taskIdx < TASK_COUNT) [[likely]]
+            {
+                data.tasks[taskIdx].record(cycles);
+            }
+        }
+
+        constexpr auto recordSlot(std::size_t slot, Driver::CycleCpu cycles) noexcept -> void
+        {
+            if (slot < SlotsPerCycle) [[likely]]
+            {
+                data.slots[slot].record(cycles);
+            }
+        }
+
+        constexpr auto reset() noexcept -> void
+        {
+            data = Snapshot{};
+        }
+
+        /**
+         * @brief Returns the collected statistics.
+         *
+         * @details
+         * Returned by reference: the full set is close to 1 KiB, which is as large as the whole
+         * main stack on the STM32F103. Copy it only where memory allows (e.g. host tests).
+         */
+        [[nodiscard]] constexpr auto snapshot() const noexcept -> const Snapshot &
+        {
+            return data;
+        }
+
+    private:
+        Snapshot data{};
+
+        static_assert(SlotsPerCycle > 0U, "SlotsPerCycle must be greater than zero.");
+    };
+
+    /**
+     * @brief Text formatter for profiling statistics.
+     *
+     * @details
+     * Produces one CSV line per statistics entry, suitable for a serial terminal:
+     * @code
+     * <label>,<index>,<count>,<min>,<mean>,<p99>,<max>\n
+     * @endcode
+     * All values are in CycleClock cycles.
+     */
+    class SchedulerProfileReport final
+    {
+    public:
+        SchedulerProfileReport() = delete;
+        ~SchedulerProfileReport() = delete;
+        SchedulerProfileReport(const SchedulerProfileReport &) = delete;
+        SchedulerProfileReport &operator=(const SchedulerProfileReport &) = delete;
+        SchedulerProfileReport(SchedulerProfileReport &&) = delete;
+        SchedulerProfileReport &operator=(SchedulerProfileReport &&) = delete;
+
+        /// @brief Buffer size sufficient for one formatted line.
+        static constexpr std::size_t LINE_BUFFER_SIZE{96U};
+
+        /// @brief Percentile reported in the tail column.
+        static constexpr std::uint8_t TAIL_PERCENTILE{99U};
+
+        /**
+         * @brief Formats one statistics entry.
+         *
+         * @param label  Entry kind, e.g. "task" or "slot".
+         * @param index  TaskId or slot index.
+         * @param stats  Statistics to format.
+         * @param output Destination buffer.
+         * @return Number of characters written, or 0 if the buffer is too small.
+         */
+        [[nodiscard]] static auto formatLine(std::string_view label,
+                                             std::size_t index,
+                                             const CycleStats &stats,
+                                             std::span<char> output) noexcept -> std::size_t
+        {
+            const Driver::CycleCpu minValue = (stats.count != 0U) ? stats.min : 0U;
+
+            std::size_t offset = 0U;
+            bool ok = (label.size() < output.size());
+
+            if (ok) [[likely]]
+            {
+                label.copy(output.data(), label.size());
+                offset = label.size();
+            }
+
+            const std::array<std::uint64_t, 6U> fields{
+                index,
+                stats.count,
+                minValue,
+                stats.mean(),
+                stats.percentile(TAIL_PERCENTILE),
+                stats.max};
+
+            for (const std::uint64_t field : fields)
+            {
+                ok = ok && appendChar(output, offset, ',') && appendNumber(output, offset, field);
+            }
+
+            ok = ok && appendChar(output, offset, '\n');
+
+            return ok ? offset : 0U;
+        }
+
+    private:
+        static auto appendChar(std::span<char> output, std::size_t &offset, char value) noexcept -> bool
+        {
+            bool status = false;
+
+            if (offset < output.size())
+            {
+                output[offset++] = value;
+                status = true;
+            }
+
+            return status;
+        }
+
+        static auto appendNumber(std::span<char> output, std::size_t &offset, std::uint64_t value) noexcept -> bool
+        {
+            const auto result = std::to_chars(output.data() + offset,
+                                              output.data() + output.size(),
+                                              value);
+
+            const bool status = (result.ec == std::errc{});
+
+            if (status)
+            {
+                offset = static_cast<std::size_t>(result.ptr - output.data());
+            }
+
+            return status;
+        }
+    };
+
+    static_assert(SchedulerProfilingPolicy<NoProfiling>,
+                  "NoProfiling must satisfy SchedulerProfilingPolicy.");
+
+    static_assert(SchedulerProfilingPolicy<CycleProfiler<1U>>,
+                  "CycleProfiler must satisfy SchedulerProfilingPolicy.");
+
+    static_assert(std::is_empty_v<NoProfiling>,
+                  "NoProfiling must be empty so [[no_unique_address]] removes it from the scheduler layout.");
+
+    static_assert(std::is_trivially_copyable_v<CycleStats>,
+                  "CycleStats should be trivially copyable so snapshots are plain memory copies.");
+
+    static_assert(CycleStats::bucketUpperBound(0U) == 0U,
+                  "Bucket 0 must hold only the value zero.");
+
+    static_assert(CycleStats::bucketUpperBound(CycleStats::HISTOGRAM_BUCKETS - 1U) ==
+                      std::numeric_limits<Driver::CycleCpu>::max(),
+                  "The last bucket must cover the full CycleCpu range.");
+} // namespace BusinessLogic
@@ -0,0 +1,234 @@
+/**
+ * @file SchedulerTrace.cppm
+ * @brief Lock-free trace ring for scheduler, interrupt and recorder events.
+ */
+module;
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+export module BusinessLogic.SchedulerTrace;
+
+import BusinessLogic.TraceFormat;
+
+import Driver.CycleCpu;
+import Driver.CycleClock;
+import Driver.CoreClockConfig;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief Fixed-size lock-free ring of trace records.
+     *
+     * @tparam Capacity Number of records; must be a power of two.
+     *
+     * @details
+     * Writers claim a slot with a compare-and-swap on the head index, so the main loop and
+     * interrupts can record concurrently (an ISR may preempt a writer in the main loop).
+     * Every slot carries a commit sequence written last, so the single reader (main loop)
+     * never returns a record that is still being written. When the ring is full new records
+     * are dropped and counted; existing records are never overwritten.
+     */
+    template <std::size_t Capacity>
+    class TraceRing final
+    {
+    public:
+        /// @brief Number of records the ring can hold.
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        /**
+         * @brief Appends a record. ISR-safe.
+         *
+         * @return false if the ring was full and the record was dropped.
+         */
+        auto push(const TraceRecord &record) noexcept -> bool
+        {
+            std::uint32_t position = head.load(std::memory_order_relaxed);
+            bool claimed = false;
+            bool full = false;
+
+            do
+            {
+                if ((position - tail.load(std::memory_order_acquire)) >= Capacity)
+                {
+                    full = true;
+                }
+                else
+                {
+                    claimed = head.compare_exchange_weak(position,
+                                                         position + 1U,
+                                                         std::memory_order_relaxed);
+                }
+            } while (!claimed && !full);
+
+            if (claimed) [[likely]]
+            {
+                const std::size_t index = position % Capacity;
+                records[index] = record;
+                committed[index].store(position + 1U, std::memory_order_release);
+            }
+            else
+            {
+                dropped.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            return claimed;
+        }
+
+        /**
+         * @brief Removes the oldest committed record. Single reader only.
+         *
+         * @return false if the ring is empty or the oldest record is not committed yet.
+         */
+        [[nodiscard]] auto pop(TraceRecord &out) noexcept -> bool
+        {
+            const std::uint32_t position = tail.load(std::memory_order_relaxed);
+            const std::size_t index = position % Capacity;
+
+            const bool available =
+                (position != head.load(std::memory_order_acquire)) &&
+                (committed[index].load(std::memory_order_acquire) == (position + 1U));
+
+            if (available)
+            {
+                out = records[index];
+                tail.store(position + 1U, std::memory_order_release);
+            }
+
+            return available;
+        }
+
+        /// @brief Number of records waiting to be read.
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+
+        /// @brief Number of records dropped since the last takeDropped().
+        [[nodiscard]] auto getDropped() const noexcept -> std::uint32_t
+        {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the number of dropped records and resets the counter.
+        [[nodiscard]] auto takeDropped() noexcept -> std::uint32_t
+        {
+            return dropped.exchange(0U, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<TraceRecord, Capacity> records{};
+        std::array<std::atomic<std::uint32_t>, Capacity> committed{};
+        std::atomic<std::uint32_t> head{0U};
+        std::atomic<std::uint32_t> tail{0U};
+        std::atomic<std::uint32_t> dropped{0U};
+
+        static_assert((Capacity != 0U) && ((Capacity & (Capacity - 1U)) == 0U),
+                      "TraceRing capacity must be a power of two so indices stay valid across 32-bit wrap.");
+    };
+
+    /**
+     * @brief True when the firmware is built with HDL_SCHEDULER_TRACE.
+     */
+#if defined(HDL_SCHEDULER_TRACE)
+    inline constexpr bool TRACE_ENABLED{true};
+#else
+    inline constexpr bool TRACE_ENABLED{false};
+#endif
+
+    /// @brief Number of records buffered between two drains.
+    inline constexpr std::size_t TRACE_CAPACITY{TRACE_ENABLED ? 128U : 1U};
+
+    /**
+     * @brief Global scheduler trace used by the firmware and the simulation.
+     *
+     * @details
+     * Instrumentation points call record(); without HDL_SCHEDULER_TRACE the calls compile
+     * to nothing. Records are timestamped with Driver::CycleClock, which counts CPU cycles
+     * on hardware and coreHz-scaled host time in the simulation, so traces of both builds
+     * share one time base.
+     *
+     * readBlock() drains the ring into the TraceWire format; the host trace decoder turns
+     * the blocks into Chrome trace JSON.
+     */
+    class SchedulerTrace final
+    {
+    public:
+        SchedulerTrace() = delete;
+        ~SchedulerTrace() = delete;
+        SchedulerTrace(const SchedulerTrace &) = delete;
+        SchedulerTrace &operator=(const SchedulerTrace &) = delete;
+        SchedulerTrace(SchedulerTrace &&) = delete;
+        SchedulerTrace &operator=(SchedulerTrace &&) = delete;
+
+        /// @brief Records per block sent by the firmware.
+        static constexpr std::size_t BLOCK_RECORDS{16U};
+
+        /// @brief Size of a block carrying BLOCK_RECORDS records.
+        static constexpr std::size_t BLOCK_SIZE{TraceWire::HEADER_SIZE +
+                                               (BLOCK_RECORDS * TraceWire::RECORD_SIZE)};
+
+        /**
+         * @brief Records an event with the current cycle counter value. ISR-safe.
+         */
+        static auto record(TraceEventType type, std::uint8_t id, std::uint16_t arg = 0U) noexcept -> void
+        {
+            if constexpr (TRACE_ENABLED)
+            {
+                static_cast<void>(ring.push(TraceRecord{.timestamp = Driver::CycleClock::now(),
+                                                        .type = type,
+                                                        .id = id,
+                                                        .arg = arg}));
+            }
+        }
+
+        /**
+         * @brief Drains buffered records into one encoded block.
+         *
+         * @details
+         * Takes as many records as fit into @p out. Must be called from one context only.
+         *
+         * @return Encoded block size, or 0 if tracing is disabled, nothing is buffered and
+         *         nothing was dropped, or @p out cannot hold a header.
+         */
+        [[nodiscard]] static auto readBlock(std::span<std::uint8_t> out) noexcept -> std::size_t
+        {
+            std::size_t result = 0U;
+
+            if constexpr (TRACE_ENABLED)
+            {
+                if ((out.size() >= TraceWire::HEADER_SIZE) &&
+                    ((ring.size() != 0U) || (ring.getDropped() != 0U)))
+                {
+                    std::size_t offset = TraceWire::HEADER_SIZE;
+                    std::uint16_t count = 0U;
+                    TraceRecord record{};
+
+                    while (((offset + TraceWire::RECORD_SIZE) <= out.size()) &&
+                           (count < std::numeric_limits<std::uint16_t>::max()) && ring.pop(record))
+                    {
+                        offset += TraceWire::encodeRecord(record, out.subspan(offset));
+                        ++count;
+                    }
+
+                    const TraceBlockHeader header{
+                        .recordCount = count,
+                        .droppedRecords = ring.takeDropped(),
+                        .cycleHz = static_cast<std::uint32_t>(Driver::coreHz)};
+
+                    static_cast<void>(TraceWire::encodeHeader(header, out));
+                    result = offset;
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        inline static TraceRing<TRACE_CAPACITY> ring{};
+    };
+} // namespace BusinessLogic
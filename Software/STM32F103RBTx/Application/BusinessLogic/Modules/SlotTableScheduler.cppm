@@ -10,11 +10,16 @@ module;
 
 export module BusinessLogic.SlotTableScheduler;
 
+import BusinessLogic.BackgroundJob;
 import BusinessLogic.TickDelegate;
 import BusinessLogic.TaskId;
+import BusinessLogic.SchedulerProfiler;
+import BusinessLogic.SchedulerTrace;
+import BusinessLogic.TraceFormat;
 
 import Driver.CycleCpu;
 import Driver.CycleClock;
+import Driver.IsrEvent;
 
 export namespace BusinessLogic
 {
@@ -102,6 +107,16 @@ export namespace BusinessLogic
          */
         bool schedulerLag{false};
 
+        /**
+         * @brief Load-shedding state of the most recent runPending() call.
+         *
+         * @details
+         * True when the call started with more than maxCatchUpPerCall pending slots and
+         * therefore ran only CRITICAL tasks (plus one call of each COALESCIBLE task).
+         * Not latched; see @ref shedSlots for cumulative information.
+         */
+        bool loadShedding{false};
+
         /**
          * @brief Index of the most recently executed slot.
          *
@@ -142,6 +157,135 @@ export namespace BusinessLogic
          * Note: the backlog may increase concurrently due to ISR activity.
          */
         std::uint32_t backlogAfterRun{0U};
+
+        /**
+         * @brief Number of slots executed in load-shedding mode.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t shedSlots{0U};
+
+        /**
+         * @brief Number of SHEDDABLE task calls skipped in load-shedding mode.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t shedTasks{0U};
+
+        /**
+         * @brief Number of COALESCIBLE task calls merged into an earlier call in load-shedding mode.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t coalescedTasks{0U};
+
+        /**
+         * @brief Number of event-triggered task calls skipped because no trigger event was pending.
+         *
+         * @details
+         * Cumulative until clearStatus(). Each count is a task call (and its polling work)
+         * avoided while the MCU can stay in sleep.
+         */
+        std::uint32_t eventSkippedTasks{0U};
+
+        /**
+         * @brief Number of empty slots slept through in tickless idle mode.
+         *
+         * @details
+         * Cumulative until clearStatus(). Each count is one timer wakeup that was avoided.
+         */
+        std::uint32_t idleSkippedSlots{0U};
+
+        /**
+         * @brief Number of background jobs queued after the most recent runPending() call.
+         */
+        std::uint32_t backgroundQueueDepth{0U};
+
+        /**
+         * @brief Highest background queue depth observed.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundQueueHighWater{0U};
+
+        /**
+         * @brief Number of background jobs rejected by submitJob() because the queue was full.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundJobsRejected{0U};
+
+        /**
+         * @brief Number of background jobs that returned JobState::DONE.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundJobsCompleted{0U};
+
+        /**
+         * @brief Number of background jobs that returned JobState::FAILED.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundJobsFailed{0U};
+
+        /**
+         * @brief Number of slot runs in which queued background jobs got no slice.
+         *
+         * @details
+         * A run starves the queue when a backlog remains or the slot tasks used the whole
+         * background window. Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundStarvedRuns{0U};
+
+        /**
+         * @brief Longest sequence of consecutive starved slot runs.
+         *
+         * @details
+         * Cumulative until clearStatus().
+         */
+        std::uint32_t backgroundMaxStarvedRuns{0U};
+
+        /**
+         * @brief Cycles from the slot timer interrupt to the start of the slot it released.
+         *
+         * @details
+         * One sample per runPending() call that drains the backlog: the latency of the slot
+         * released by the most recent timer interrupt. With a catch-up of several slots the
+         * sample includes the runtime of the slots executed before it. Calls during which a
+         * further interrupt arrived are not sampled (see @ref dispatchLatencyUnmeasured).
+         * Jitter is max - min, or percentile(99) - min for a tail estimate.
+         * Cumulative until clearStatus().
+         */
+        CycleStats dispatchLatency{};
+
+        /**
+         * @brief Largest difference between two consecutive dispatch latency samples.
+         *
+         * @details
+         * Cycle-to-cycle jitter as seen by a periodic sampling task.
+         * Cumulative until clearStatus().
+         */
+        Driver::CycleCpu dispatchJitterMax{0U};
+
+        /// @brief Most recent dispatch latency sample.
+        Driver::CycleCpu lastDispatchLatency{0U};
+
+        /**
+         * @brief Number of runPending() calls that executed slots but took no latency sample.
+         *
+         * @details
+         * Happens when a backlog remains after the call or the timer interrupt fired again
+         * while the call was running. Cumulative until clearStatus().
+         */
+        std::uint32_t dispatchLatencyUnmeasured{0U};
     };
 
     /**
@@ -149,6 +293,9 @@ export namespace BusinessLogic
      *
      * @tparam SlotsPerCycle   Number of slots in one scheduler cycle.
      * @tparam MaxTasksPerSlot Maximum number of tasks that can execute in a slot.
+     * @tparam Profiler        Profiling policy (see SchedulerProfilingPolicy). NoProfiling by
+     *                         default; CycleProfiler records per-task and per-slot cycle statistics.
+     * @tparam BackgroundJobCapacity Maximum number of queued background jobs.
      *
      * @details
      * High-level behavior:
@@ -171,11 +318,59 @@ export namespace BusinessLogic
      * - @ref Status::error is "last error wins" (may overwrite previous errors).
      * - Boolean flags remain latched until clearStatus().
      *
+     * Load shedding:
+     * - If the backlog at call entry exceeds maxCatchUpPerCall, up to maxShedCatchUpPerCall
+     *   slots are executed with reduced work: CRITICAL tasks run in every slot, COALESCIBLE
+     *   tasks run at most once per call and SHEDDABLE tasks are skipped (see TaskCriticality).
+     *   This lets the scheduler return to real time without dropping measurement slots.
+     *
+     * Event-triggered tasks:
+     * - Interrupts report hardware events with notifyEventIsr(), which sets a bit in an atomic
+     *   event flag word.
+     * - A task with a non-zero entry in Config::taskTriggers runs in its slot only if one of
+     *   its trigger events is pending; those events are consumed when the task is called.
+     *   Tasks with a zero entry run periodically as before.
+     *
+     * Tickless idle:
+     * - When the main loop has nothing to do it may call idleSlotsUntilWork() and stretch the
+     *   slot timer period to the returned number of slots, sleeping through empty slots.
+     * - On wake the timer ISR calls notifyTimeSlotsElapsedIsr() with the number of slot periods
+     *   that actually elapsed. runPending() then skips the empty slots without executing them,
+     *   so slotIndex stays aligned with the time base and task periods do not change.
+     *
+     * Background jobs:
+     * - Long operations are submitted with submitJob() and run in the slack left after the
+     *   slot tasks, measured with Driver::CycleClock from the start of the last executed slot
+     *   up to Config::backgroundWindowCycles.
+     * - Each queued job gets at most one slice per runPending() call, in FIFO order, with the
+     *   remaining cycle budget passed to BackgroundJob. Jobs returning MORE_WORK are queued again.
+     * - No slices run while a slot backlog remains. Queue depth, completions and starvation
+     *   are reported in @ref Status.
+     *
+     * Dispatch latency:
+     * - The time slot ISR hooks store the CycleClock value of the interrupt. runPending()
+     *   compares it with the start of the slot released by that interrupt, which shows how much
+     *   WFI wakeup, interrupt nesting and catch-up add to the sampling jitter (see
+     *   @ref Status::dispatchLatency). The ISR stamp is taken in the HAL callback, so HAL
+     *   interrupt entry time is not included.
+     *
+     * Tracing:
+     * - Slot and task start/end and the ISR hooks are recorded in SchedulerTrace. Without
+     *   HDL_SCHEDULER_TRACE these calls compile to nothing.
+     *
+     * Profiling:
+     * - When Profiler::ENABLED is true, every task call is timed with Driver::CycleClock and
+     *   reported to the policy together with the elapsed cycles of each slot.
+     * - With the default NoProfiling policy no extra cycle counter reads are made.
+     *
      * Lifetime:
      * - This scheduler is non-owning. SlotTable and TaskCallTable are referenced and must
      *   outlive the SlotTableScheduler instance.
      */
-    template <std::size_t SlotsPerCycle, std::size_t MaxTasksPerSlot>
+    template <std::size_t SlotsPerCycle,
+              std::size_t MaxTasksPerSlot,
+              SchedulerProfilingPolicy Profiler = NoProfiling,
+              std::size_t BackgroundJobCapacity = 4U>
     class SlotTableScheduler final
     {
     public:
@@ -188,6 +383,15 @@ export namespace BusinessLogic
          */
         static constexpr std::size_t TASK_COUNT = std::to_underlying(TaskId::LAST_NOT_USED);
 
+        /// @brief Number of slots in one scheduler cycle.
+        static constexpr std::size_t SLOTS_PER_CYCLE = SlotsPerCycle;
+
+        /// @brief Maximum number of tasks in one slot.
+        static constexpr std::size_t MAX_TASKS_PER_SLOT = MaxTasksPerSlot;
+
+        /// @brief Maximum number of queued background jobs.
+        static constexpr std::size_t BACKGROUND_JOB_CAPACITY = BackgroundJobCapacity;
+
         /**
          * @brief Definition of one slot in the schedule.
          *
@@ -235,6 +439,25 @@ export namespace BusinessLogic
          */
         using TaskCallTable = std::array<TickDelegate, TASK_COUNT>;
 
+        /// @brief Bit set of Driver::IsrEvent values (bit n = event with value n).
+        using EventMask = std::uint32_t;
+
+        /**
+         * @brief Trigger events per task, indexed by TaskId.
+         *
+         * @details
+         * Zero means the task is periodic. A non-zero mask makes the task event-triggered.
+         */
+        using TaskTriggerTable = std::array<EventMask, TASK_COUNT>;
+
+        /**
+         * @brief Returns the EventMask bit of one event.
+         */
+        [[nodiscard]] static constexpr auto eventMask(Driver::IsrEvent event) noexcept -> EventMask
+        {
+            return (EventMask{1U} << std::to_underlying(event));
+        }
+
         /**
          * @brief Scheduler configuration.
          *
@@ -257,6 +480,27 @@ export namespace BusinessLogic
              * value, schedulerLag is latched.
              */
             std::uint32_t maxCatchUpPerCall{2U};
+
+            /**
+             * @brief Maximum number of slots executed per runPending() call in load-shedding mode.
+             *
+             * @details
+             * Used instead of maxCatchUpPerCall when the backlog at call entry exceeds
+             * maxCatchUpPerCall. Should be larger than maxCatchUpPerCall so the backlog shrinks.
+             */
+            std::uint32_t maxShedCatchUpPerCall{8U};
+
+            /// @brief Trigger events per task; all zero (periodic) by default.
+            TaskTriggerTable taskTriggers{};
+
+            /**
+             * @brief Cycles after the start of a slot within which background jobs may run.
+             *
+             * @details
+             * Should be the slot period minus a margin for interrupt load. Zero disables
+             * background jobs; they stay queued.
+             */
+            Driver::CycleCpu backgroundWindowCycles{0U};
         };
 
         /**
@@ -271,8 +515,14 @@ export namespace BusinessLogic
             : slotTableRef(cfg.slotTable),
               taskCallTable(cfg.taskCallTable),
               maxCatchUpPerCall(cfg.maxCatchUpPerCall),
+              maxShedCatchUpPerCall(cfg.maxShedCatchUpPerCall),
+              taskTriggers(cfg.taskTriggers),
+              backgroundWindowCycles(cfg.backgroundWindowCycles),
               slotIndex(0U),
               pendingSlots(0U),
+              idleSlots(0U),
+              tickStamp(0U),
+              eventFlags(0U),
               isStarted(false),
               status{}
         {
@@ -283,8 +533,11 @@ export namespace BusinessLogic
          *
          * @details
          * - Validates that every TickDelegate in the TaskCallTable is bound.
-         * - Initializes the cycle counter driver.
-         * - Resets slot index, pending backlog, and status diagnostics.
+         * - Resets slot index, pending backlog, pending events, status diagnostics, and profiling data.
+         * - Keeps already submitted background jobs.
+         *
+         * Driver::CycleClock must already be initialized: the scheduler shares its time line
+         * with the measurement timestamps, so it does not reset the counter.
          *
          * @return True if the scheduler started successfully; false otherwise.
          */
@@ -292,11 +545,15 @@ export namespace BusinessLogic
         {
             if (isTaskCallTableComplete())
             {
-                Driver::CycleClock::init();
                 slotIndex = 0U;
                 pendingSlots.store(0U, std::memory_order_relaxed);
+                idleSlots.store(0U, std::memory_order_relaxed);
+                tickStamp.store(0U, std::memory_order_relaxed);
+                eventFlags.store(0U, std::memory_order_relaxed);
                 isStarted = true;
                 status = Status{};
+                starvedRuns = 0U;
+                profiler.reset();
             }
             else
             {
@@ -311,12 +568,111 @@ export namespace BusinessLogic
          * @brief ISR hook: increments the pending slot backlog by one.
          *
          * @details
-         * Intended to be called from interrupt context. Uses relaxed atomic operations because
-         * only the numeric value of the counter is required.
+         * Intended to be called from interrupt context. Stores the cycle counter value of the
+         * interrupt for the dispatch latency measurement.
          */
         auto notifyTimeSlotIsr() noexcept -> void
         {
-            pendingSlots.fetch_add(1U, std::memory_order_relaxed);
+            tickStamp.store(Driver::CycleClock::now(), std::memory_order_relaxed);
+            SchedulerTrace::record(TraceEventType::ISR_TIME_SLOT, 0U, 1U);
+
+            // Release orders the stamp before the pending slot it belongs to.
+            pendingSlots.fetch_add(1U, std::memory_order_release);
+        }
+
+        /**
+         * @brief ISR hook for tickless idle: reports the end of a stretched timer period.
+         *
+         * @details
+         * Intended to be called from interrupt context instead of notifyTimeSlotIsr() when the
+         * timer period was stretched according to idleSlotsUntilWork(). The last elapsed slot
+         * becomes pending; the slots before it were empty and are skipped by the next
+         * runPending() call. An elapsedSlots value of 1 behaves like notifyTimeSlotIsr().
+         *
+         * @param elapsedSlots Number of slot periods covered by the timer period (>= 1).
+         */
+        auto notifyTimeSlotsElapsedIsr(std::uint32_t elapsedSlots) noexcept -> void
+        {
+            tickStamp.store(Driver::CycleClock::now(), std::memory_order_relaxed);
+            SchedulerTrace::record(TraceEventType::ISR_TIME_SLOT, 0U, static_cast<std::uint16_t>(elapsedSlots));
+
+            if (elapsedSlots > 1U) [[unlikely]]
+            {
+                idleSlots.fetch_add(elapsedSlots - 1U, std::memory_order_relaxed);
+            }
+
+            // Release orders the stamp and the idle skip before the pending slot that follows them.
+            pendingSlots.fetch_add(1U, std::memory_order_release);
+        }
+
+        /**
+         * @brief Computes how many slot periods the CPU may sleep before work is due.
+         *
+         * @details
+         * Intended to be called from the main loop right before entering sleep. Looks ahead from
+         * the next slot to execute and returns the distance to the first slot with at least one
+         * task, counted in timer periods (1 = the next slot has work, i.e. normal ticking).
+         * Event-triggered tasks count as work even without a pending event, so no event is
+         * served later than in periodic mode.
+         *
+         * Returns 1 when the scheduler is not started or slots are already pending.
+         *
+         * @param maxSlots Longest timer period the caller can program, in slots (>= 1).
+         * @return Number of slot periods in [1, maxSlots].
+         */
+        [[nodiscard]] auto idleSlotsUntilWork(std::uint32_t maxSlots) const noexcept -> std::uint32_t
+        {
+            std::uint32_t result = 1U;
+
+            if (isStarted && (maxSlots > 1U) &&
+                (pendingSlots.load(std::memory_order_relaxed) == 0U) &&
+                (idleSlots.load(std::memory_order_relaxed) == 0U))
+            {
+                bool found = false;
+                result = maxSlots;
+
+                for (std::uint32_t distance = 0U; (distance < maxSlots) && !found; ++distance)
+                {
+                    const Slot &slot = slotTableRef[(slotIndex + distance) % SlotsPerCycle];
+
+                    if (slot.taskIdCount != 0U)
+                    {
+                        result = distance + 1U;
+                        found = true;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief ISR hook: marks a hardware event as pending.
+         *
+         * @details
+         * Intended to be called from interrupt context (EXTI, DMA complete, UART idle).
+         * The event stays pending until a task triggered by it is called. It is traced only
+         * when it becomes pending, so a fast interrupt source cannot fill the trace ring.
+         *
+         * @param event Event that occurred.
+         */
+        auto notifyEventIsr(Driver::IsrEvent event) noexcept -> void
+        {
+            const EventMask mask = eventMask(event);
+            const EventMask pending = eventFlags.fetch_or(mask, std::memory_order_release);
+
+            if ((pending & mask) == 0U)
+            {
+                SchedulerTrace::record(TraceEventType::ISR_EVENT, std::to_underlying(event));
+            }
+        }
+
+        /**
+         * @brief Returns the currently pending events.
+         */
+        [[nodiscard]] auto getPendingEvents() const noexcept -> EventMask
+        {
+            return eventFlags.load(std::memory_order_acquire);
         }
 
         /**
@@ -326,7 +682,9 @@ export namespace BusinessLogic
          * If called before start(), NOT_STARTED is stored in status.error and false is returned.
          *
          * In one call, at most maxCatchUpPerCall slots are executed. If the backlog at call entry
-         * exceeds maxCatchUpPerCall, schedulerLag is latched.
+         * exceeds maxCatchUpPerCall, schedulerLag is latched and the call switches to
+         * load-shedding mode, executing up to maxShedCatchUpPerCall slots with reduced work.
+         * Executed slots are removed from the pending backlog.
          *
          * @return True if the scheduler was started and did not begin the call with lag;
          *         false otherwise (NOT_STARTED or lag at entry).
@@ -342,18 +700,39 @@ export namespace BusinessLogic
             }
             else
             {
-                status.pendingSlotsAtStart = pendingSlots.load(std::memory_order_relaxed);
+                status.pendingSlotsAtStart = pendingSlots.load(std::memory_order_acquire);
+                const Driver::CycleCpu latestTick = tickStamp.load(std::memory_order_relaxed);
 
-                if (status.pendingSlotsAtStart > maxCatchUpPerCall)
+                // Empty slots slept through in tickless idle precede the pending ones.
+                const std::uint32_t skipped = idleSlots.exchange(0U, std::memory_order_relaxed);
+
+                if (skipped != 0U) [[unlikely]]
+                {
+                    slotIndex = (slotIndex + skipped) % SlotsPerCycle;
+                    status.idleSkippedSlots += skipped;
+                }
+
+                status.loadShedding = (status.pendingSlotsAtStart > maxCatchUpPerCall);
+
+                if (status.loadShedding)
                 {
                     status.schedulerLag = true;
                     status.error = Error::SCHEDULER_LAG_LATCHED;
                 }
 
+                const std::uint32_t limit =
+                    status.loadShedding ? maxShedCatchUpPerCall : maxCatchUpPerCall;
+
                 const std::uint32_t toRun =
-                    (status.pendingSlotsAtStart < maxCatchUpPerCall)
+                    (status.pendingSlotsAtStart < limit)
                         ? status.pendingSlotsAtStart
-                        : maxCatchUpPerCall;
+                        : limit;
+
+                // One bit per TaskId: COALESCIBLE tasks already executed in this call.
+                std::uint32_t coalescedMask = 0U;
+
+                // Only the last pending slot belongs to latestTick, and only if it runs now.
+                bool latencySampled = false;
 
                 for (std::uint32_t i = 0U; i < toRun; ++i)
                 {
@@ -364,36 +743,64 @@ export namespace BusinessLogic
 
                     status.lastSlot = slotIndex;
                     status.lastStart = Driver::CycleClock::now();
+                    SchedulerTrace::record(TraceEventType::SLOT_START, static_cast<std::uint8_t>(slotIndex));
 
-                    for (TaskId taskId : taskIds)
+                    if ((i + 1U) == status.pendingSlotsAtStart)
                     {
-                        const std::size_t taskIdx = std::to_underlying(taskId);
+                        latencySampled = recordDispatchLatency(latestTick);
+                    }
 
-                        if (taskCallTable[taskIdx]() == false)
+                    for (TaskId taskId : taskIds)
+                    {
+                        if (shouldRunTask(taskId, status.loadShedding, coalescedMask) &&
+                            consumeTrigger(taskId))
                         {
-                            status.taskFailed = true;
-                            status.error = Error::TASK_FAILED_LATCHED;
+                            if (runTask(taskId) == false)
+                            {
+                                status.taskFailed = true;
+                                status.error = Error::TASK_FAILED_LATCHED;
+                            }
                         }
                     }
 
                     status.lastEnd = Driver::CycleClock::now();
+                    SchedulerTrace::record(TraceEventType::SLOT_END, static_cast<std::uint8_t>(slotIndex));
 
                     const Driver::CycleCpu elapsed =
                         Driver::CycleClock::elapsed(status.lastStart, status.lastEnd);
 
+                    profiler.recordSlot(slotIndex, elapsed);
+
                     if ((slot.budgetCycles != 0U) && (elapsed > slot.budgetCycles))
                     {
                         status.slotOverrun = true;
                         status.error = Error::SLOT_OVERRUN_LATCHED;
                     }
 
+                    if (status.loadShedding)
+                    {
+                        ++status.shedSlots;
+                    }
+
                     // Circular increment.
                     (++slotIndex) %= SlotsPerCycle;
                 }
 
+                pendingSlots.fetch_sub(toRun, std::memory_order_relaxed);
+
                 status.backlogAfterRun = pendingSlots.load(std::memory_order_relaxed);
 
-                if (status.pendingSlotsAtStart > maxCatchUpPerCall)
+                if (toRun != 0U)
+                {
+                    if (!latencySampled)
+                    {
+                        ++status.dispatchLatencyUnmeasured;
+                    }
+
+                    runBackgroundJobs();
+                }
+
+                if (status.loadShedding)
                 {
                     result = false;
                 }
@@ -402,6 +809,32 @@ export namespace BusinessLogic
             return result;
         }
 
+        /**
+         * @brief Queues a background job.
+         *
+         * @details
+         * Must be called from the main loop context (e.g. from a task), not from an ISR.
+         * The job object must stay alive until it returns DONE or FAILED.
+         *
+         * @param job Bound job delegate.
+         * @return false if the queue is full or the job is unbound.
+         */
+        [[nodiscard]] auto submitJob(BackgroundJob job) noexcept -> bool
+        {
+            const bool result = jobQueue.push(job);
+
+            if (result)
+            {
+                updateQueueDepth();
+            }
+            else
+            {
+                ++status.backgroundJobsRejected;
+            }
+
+            return result;
+        }
+
         /**
          * @brief Returns a const reference to the current scheduler status.
          *
@@ -418,14 +851,275 @@ export namespace BusinessLogic
          * @brief Clears latched status flags and error code.
          *
          * @details
-         * Does not modify the scheduler started state and does not affect the pending slot backlog.
+         * Does not modify the scheduler started state and does not affect the pending slot backlog
+         * or queued background jobs.
          */
         auto clearStatus() noexcept -> void
         {
             status = Status{};
+            updateQueueDepth();
+        }
+
+        /**
+         * @brief Returns a const reference to the profiling policy.
+         *
+         * @details
+         * With CycleProfiler, call snapshot() on the returned object to obtain a copy of the
+         * per-task and per-slot statistics. Intended to be read from the main loop context.
+         */
+        [[nodiscard]] auto getProfiler() const noexcept -> const Profiler &
+        {
+            return profiler;
+        }
+
+        /**
+         * @brief Discards all collected profiling data.
+         */
+        auto clearProfile() noexcept -> void
+        {
+            profiler.reset();
         }
 
     private:
+        /**
+         * @brief Decides whether a scheduled task is executed in the current slot.
+         *
+         * @details
+         * Outside load-shedding mode every task runs. In load-shedding mode the decision follows
+         * getTaskCriticality() and the shed/coalesced counters in @ref Status are updated.
+         *
+         * @param taskId        Task scheduled in the current slot.
+         * @param loadShedding  True if the current runPending() call sheds load.
+         * @param coalescedMask Bit per TaskId of COALESCIBLE tasks already run in this call.
+         * @return True if the task should be called.
+         */
+        [[nodiscard]] auto shouldRunTask(TaskId taskId,
+                                         bool loadShedding,
+                                         std::uint32_t &coalescedMask) noexcept -> bool
+        {
+            bool result = true;
+
+            if (loadShedding)
+            {
+                const std::uint32_t taskBit = (std::uint32_t{1U} << std::to_underlying(taskId));
+
+                switch (getTaskCriticality(taskId))
+                {
+                case TaskCriticality::CRITICAL:
+                    break;
+
+                case TaskCriticality::COALESCIBLE:
+                    if ((coalescedMask & taskBit) != 0U)
+                    {
+                        ++status.coalescedTasks;
+                        result = false;
+                    }
+                    else
+                    {
+                        coalescedMask |= taskBit;
+                    }
+                    break;
+
+                case TaskCriticality::SHEDDABLE:
+                default:
+                    ++status.shedTasks;
+                    result = false;
+                    break;
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Checks and consumes the trigger events of a task.
+         *
+         * @details
+         * Periodic tasks (zero trigger mask) always pass. For event-triggered tasks the trigger
+         * bits are cleared atomically, so events raised while the task runs stay pending for
+         * the next activation.
+         *
+         * @param taskId Task about to be called.
+         * @return True if the task should be called.
+         */
+        [[nodiscard]] auto consumeTrigger(TaskId taskId) noexcept -> bool
+        {
+            const EventMask trigger = taskTriggers[std::to_underlying(taskId)];
+            bool result = true;
+
+            if (trigger != 0U)
+            {
+                const EventMask pending = eventFlags.fetch_and(~trigger, std::memory_order_acq_rel);
+                result = ((pending & trigger) != 0U);
+
+                if (!result)
+                {
+                    ++status.eventSkippedTasks;
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Adds the latency from a slot timer interrupt to the current slot start.
+         *
+         * @details
+         * The sample is discarded if another slot became pending since runPending() read the
+         * backlog, because @p tick may then belong to a slot that has not started yet.
+         *
+         * @param tick Interrupt stamp read after the pending slot count.
+         * @return True if a sample was recorded.
+         */
+        auto recordDispatchLatency(Driver::CycleCpu tick) noexcept -> bool
+        {
+            const bool result = (pendingSlots.load(std::memory_order_relaxed) == status.pendingSlotsAtStart);
+
+            if (result) [[likely]]
+            {
+                const Driver::CycleCpu latency = Driver::CycleClock::elapsed(tick, status.lastStart);
+
+                if (status.dispatchLatency.count != 0U)
+                {
+                    const Driver::CycleCpu step = (latency > status.lastDispatchLatency)
+                                                      ? (latency - status.lastDispatchLatency)
+                                                      : (status.lastDispatchLatency - latency);
+
+                    if (step > status.dispatchJitterMax)
+                    {
+                        status.dispatchJitterMax = step;
+                    }
+                }
+
+                status.dispatchLatency.record(latency);
+                status.lastDispatchLatency = latency;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Runs background job slices in the slack of the last executed slot.
+         *
+         * @details
+         * Each job queued at entry gets at most one slice. Slices stop when the background
+         * window is used up, so a job can never be called with a zero budget.
+         */
+        auto runBackgroundJobs() noexcept -> void
+        {
+            if (!jobQueue.isEmpty())
+            {
+                std::size_t slices = jobQueue.size();
+                bool served = false;
+
+                if (status.backlogAfterRun == 0U)
+                {
+                    Driver::CycleCpu remaining = remainingBackgroundCycles();
+
+                    while ((slices != 0U) && (remaining != 0U))
+                    {
+                        const BackgroundJob job = jobQueue.pop();
+
+                        switch (job(remaining))
+                        {
+                        case JobState::DONE:
+                            ++status.backgroundJobsCompleted;
+                            break;
+
+                        case JobState::MORE_WORK:
+                            // Cannot fail: the slot was freed by pop() above.
+                            static_cast<void>(jobQueue.push(job));
+                            break;
+
+                        case JobState::FAILED:
+                        default:
+                            ++status.backgroundJobsFailed;
+                            break;
+                        }
+
+                        served = true;
+                        --slices;
+                        remaining = remainingBackgroundCycles();
+                    }
+                }
+
+                if (served)
+                {
+                    starvedRuns = 0U;
+                }
+                else
+                {
+                    ++starvedRuns;
+                    ++status.backgroundStarvedRuns;
+
+                    if (starvedRuns > status.backgroundMaxStarvedRuns)
+                    {
+                        status.backgroundMaxStarvedRuns = starvedRuns;
+                    }
+                }
+            }
+
+            updateQueueDepth();
+        }
+
+        /**
+         * @brief Cycles left in the background window of the last executed slot.
+         */
+        [[nodiscard]] auto remainingBackgroundCycles() const noexcept -> Driver::CycleCpu
+        {
+            const Driver::CycleCpu used =
+                Driver::CycleClock::elapsed(status.lastStart, Driver::CycleClock::now());
+
+            const Driver::CycleCpu result =
+                (used < backgroundWindowCycles) ? (backgroundWindowCycles - used) : 0U;
+
+            return result;
+        }
+
+        /**
+         * @brief Publishes the current queue depth and its high-water mark in @ref Status.
+         */
+        auto updateQueueDepth() noexcept -> void
+        {
+            status.backgroundQueueDepth = static_cast<std::uint32_t>(jobQueue.size());
+
+            if (status.backgroundQueueDepth > status.backgroundQueueHighWater)
+            {
+                status.backgroundQueueHighWater = status.backgroundQueueDepth;
+            }
+        }
+
+        /**
+         * @brief Calls one task, timing it when profiling is enabled.
+         *
+         * @param taskId Task to execute.
+         * @return Value returned by the task.
+         */
+        [[nodiscard]] auto runTask(TaskId taskId) noexcept -> bool
+        {
+            const std::size_t taskIdx = std::to_underlying(taskId);
+            bool result = false;
+
+            SchedulerTrace::record(TraceEventType::TASK_START, std::to_underlying(taskId));
+
+            if constexpr (Profiler::ENABLED)
+            {
+                const Driver::CycleCpu taskStart = Driver::CycleClock::now();
+                result = taskCallTable[taskIdx]();
+                const Driver::CycleCpu taskEnd = Driver::CycleClock::now();
+
+                profiler.recordTask(taskId, Driver::CycleClock::elapsed(taskStart, taskEnd));
+            }
+            else
+            {
+                result = taskCallTable[taskIdx]();
+            }
+
+            SchedulerTrace::record(TraceEventType::TASK_END, std::to_underlying(taskId), result ? 1U : 0U);
+
+            return result;
+        }
+
         /**
          * @brief Validates that the TaskCallTable contains only bound delegates.
          *
@@ -459,18 +1153,45 @@ export namespace BusinessLogic
         /// @brief Catch-up limit applied in runPending().
         std::uint32_t maxCatchUpPerCall;
 
+        /// @brief Catch-up limit applied in runPending() while shedding load.
+        std::uint32_t maxShedCatchUpPerCall;
+
+        /// @brief Trigger events per task (zero = periodic).
+        TaskTriggerTable taskTriggers;
+
+        /// @brief Background window measured from the start of the last executed slot.
+        Driver::CycleCpu backgroundWindowCycles;
+
         /// @brief Index of the next slot to execute.
         std::size_t slotIndex;
 
         /// @brief Pending slot backlog (incremented by ISR).
         std::atomic<std::uint32_t> pendingSlots;
 
+        /// @brief Empty slots slept through in tickless idle, not yet skipped (incremented by ISR).
+        std::atomic<std::uint32_t> idleSlots;
+
+        /// @brief CycleClock value of the most recent slot timer interrupt (written by ISR).
+        std::atomic<Driver::CycleCpu> tickStamp;
+
+        /// @brief Pending hardware events (bits set by ISR, cleared by consumeTrigger()).
+        std::atomic<EventMask> eventFlags;
+
         /// @brief True once start() has completed successfully.
         bool isStarted;
 
         /// @brief Latched diagnostics and timing endpoints.
         Status status;
 
+        /// @brief Jobs waiting for a slice in the slot slack.
+        BackgroundJobQueue<BackgroundJobCapacity> jobQueue{};
+
+        /// @brief Consecutive slot runs without a background slice while jobs were queued.
+        std::uint32_t starvedRuns{0U};
+
+        /// @brief Profiling policy instance (occupies no storage for NoProfiling).
+        [[no_unique_address]] Profiler profiler{};
+
         static_assert(SlotsPerCycle > 0U,
                       "SlotsPerCycle must be greater than zero (required for slot indexing and modulo wrap).");
 
@@ -489,6 +1210,12 @@ export namespace BusinessLogic
         static_assert(std::to_underlying(TaskId::LAST_NOT_USED) == TASK_COUNT,
                       "TASK_COUNT must match TaskId::LAST_NOT_USED (TaskCallTable indexing relies on this).");
 
+        static_assert(TASK_COUNT <= 32U,
+                      "TASK_COUNT must fit into the 32-bit coalesced task mask used while shedding load.");
+
+        static_assert(std::to_underlying(Driver::IsrEvent::LAST_NOT_USED) <= 32U,
+                      "Every Driver::IsrEvent must map to one bit of the 32-bit EventMask.");
+
         static_assert(std::to_underlying(TaskId{0}) == 0U,
                       "TaskId must be zero-based for array indexing (expected first task id to be 0).");
 
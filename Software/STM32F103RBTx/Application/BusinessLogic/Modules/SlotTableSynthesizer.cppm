@@ -0,0 +1,315 @@
+/**
+ * @file SlotTableSynthesizer.cppm
+ * @brief Compile-time generation of SlotTableScheduler slot tables from task declarations.
+ */
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+export module BusinessLogic.SlotTableSynthesizer;
+
+import BusinessLogic.TaskId;
+
+import Driver.CycleCpu;
+import Driver.CycleBudget;
+
+export namespace BusinessLogic
+{
+    /// @brief Slot period of the scheduler time base in milliseconds (TIM2 period).
+    inline constexpr std::uint32_t SLOT_PERIOD_MS{5U};
+
+    /**
+     * @brief Slot period of the scheduler time base in CPU cycles.
+     *
+     * @details
+     * TIM2 raises one scheduler time slot every 5 ms. The summed WCET budgets of the tasks
+     * placed into one slot must fit into this period.
+     */
+    inline constexpr Driver::CycleCpu SLOT_PERIOD_CYCLES = Driver::CycleBudget::fromMs(SLOT_PERIOD_MS);
+
+    /**
+     * @brief Offset value requesting automatic placement by the synthesizer.
+     */
+    inline constexpr std::uint32_t AUTO_OFFSET = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Rate and cost declaration of one periodic task.
+     *
+     * @details
+     * A task with periodSlots = P and offsetSlots = O runs in every slot s of the cycle with
+     * (s % P) == O. P must divide the number of slots per cycle so the pattern repeats exactly.
+     */
+    struct TaskDeclaration final
+    {
+        /// @brief Task to schedule.
+        TaskId taskId{TaskId::LAST_NOT_USED};
+
+        /// @brief Activation period in scheduler slots (1 = every slot).
+        std::uint32_t periodSlots{1U};
+
+        /// @brief First slot of the period, or AUTO_OFFSET to let the synthesizer balance load.
+        std::uint32_t offsetSlots{AUTO_OFFSET};
+
+        /// @brief Worst-case execution time budget in CPU cycles.
+        Driver::CycleCpu wcetCycles{0U};
+    };
+
+    /**
+     * @brief Reason why a task set cannot be turned into a slot table.
+     */
+    enum class SynthesisError : std::uint8_t
+    {
+        /// @brief The task set is schedulable.
+        NONE = 0,
+
+        /// @brief A declaration uses TaskId::LAST_NOT_USED or an out-of-range value.
+        INVALID_TASK_ID,
+
+        /// @brief The same TaskId is declared more than once.
+        DUPLICATE_TASK_ID,
+
+        /// @brief periodSlots is zero or does not divide the number of slots per cycle.
+        INVALID_PERIOD,
+
+        /// @brief An explicit offsetSlots is not smaller than periodSlots.
+        INVALID_OFFSET,
+
+        /// @brief A slot would need more than MaxTasksPerSlot entries.
+        TOO_MANY_TASKS_IN_SLOT,
+
+        /// @brief The summed WCET budgets of a slot exceed the slot period.
+        SLOT_BUDGET_EXCEEDED
+    };
+
+    /**
+     * @brief Intermediate result of slot planning.
+     *
+     * @details
+     * Holds the per-slot task lists and budgets as plain arrays, because
+     * SlotTableScheduler::Slot has const members and can only be built in one go.
+     */
+    template <std::size_t SlotsPerCycle, std::size_t MaxTasksPerSlot>
+    struct SlotPlan final
+    {
+        /// @brief Ordered task identifiers per slot (declaration order).
+        std::array<std::array<TaskId, MaxTasksPerSlot>, SlotsPerCycle> taskIds{};
+
+        /// @brief Number of valid entries in taskIds per slot.
+        std::array<std::uint8_t, SlotsPerCycle> taskIdCount{};
+
+        /// @brief Summed WCET budget per slot.
+        std::array<Driver::CycleCpu, SlotsPerCycle> budgetCycles{};
+
+        /// @brief First detected problem, NONE if the plan is valid.
+        SynthesisError error{SynthesisError::NONE};
+    };
+
+    /**
+     * @brief Places declared tasks into slots.
+     *
+     * @details
+     * Tasks with an explicit offset are placed first. Tasks with AUTO_OFFSET are then placed
+     * in order of decreasing WCET; each one gets the offset that minimizes the highest slot
+     * load it touches (ties resolved by the lowest offset). Inside a slot, tasks keep their
+     * declaration order, and each slot budget is the sum of its tasks' WCETs.
+     *
+     * @param tasks            Task declarations.
+     * @param slotPeriodCycles Maximum summed budget of one slot.
+     * @return Plan with error set to the first problem found.
+     */
+    template <std::size_t SlotsPerCycle, std::size_t MaxTasksPerSlot, std::size_t TaskCount>
+    [[nodiscard]] consteval auto planSlots(const std::array<TaskDeclaration, TaskCount> &tasks,
+                                           Driver::CycleCpu slotPeriodCycles = SLOT_PERIOD_CYCLES)
+        -> SlotPlan<SlotsPerCycle, MaxTasksPerSlot>
+    {
+        SlotPlan<SlotsPerCycle, MaxTasksPerSlot> plan{};
+
+        // 64-bit accumulation so oversized budgets are reported instead of wrapping.
+        std::array<std::uint64_t, SlotsPerCycle> load{};
+        std::array<std::size_t, SlotsPerCycle> count{};
+        std::array<std::uint32_t, TaskCount> offsets{};
+        std::array<bool, TaskCount> placed{};
+
+        const auto occupy = [&](std::size_t task, std::uint32_t offset)
+        {
+            for (std::size_t slot = offset; slot < SlotsPerCycle; slot += tasks[task].periodSlots)
+            {
+                load[slot] += tasks[task].wcetCycles;
+                ++count[slot];
+            }
+
+            offsets[task] = offset;
+            placed[task] = true;
+        };
+
+        // Validate declarations.
+        for (std::size_t i = 0U; (i < TaskCount) && (plan.error == SynthesisError::NONE); ++i)
+        {
+            const TaskDeclaration &task = tasks[i];
+
+            if (std::to_underlying(task.taskId) >= std::to_underlying(TaskId::LAST_NOT_USED))
+            {
+                plan.error = SynthesisError::INVALID_TASK_ID;
+            }
+            else if ((task.periodSlots == 0U) || ((SlotsPerCycle % task.periodSlots) != 0U))
+            {
+                plan.error = SynthesisError::INVALID_PERIOD;
+            }
+            else if ((task.offsetSlots != AUTO_OFFSET) && (task.offsetSlots >= task.periodSlots))
+            {
+                plan.error = SynthesisError::INVALID_OFFSET;
+            }
+
+            for (std::size_t j = 0U; j < i; ++j)
+            {
+                if (tasks[j].taskId == task.taskId)
+                {
+                    plan.error = SynthesisError::DUPLICATE_TASK_ID;
+                }
+            }
+        }
+
+        // Fixed offsets first.
+        for (std::size_t i = 0U; (i < TaskCount) && (plan.error == SynthesisError::NONE); ++i)
+        {
+            if (tasks[i].offsetSlots != AUTO_OFFSET)
+            {
+                occupy(i, tasks[i].offsetSlots);
+            }
+        }
+
+        // Automatic offsets, heaviest task first.
+        for (std::size_t round = 0U; (round < TaskCount) && (plan.error == SynthesisError::NONE); ++round)
+        {
+            std::size_t next = TaskCount;
+
+            for (std::size_t i = 0U; i < TaskCount; ++i)
+            {
+                if (!placed[i] && ((next == TaskCount) || (tasks[i].wcetCycles > tasks[next].wcetCycles)))
+                {
+                    next = i;
+                }
+            }
+
+            if (next != TaskCount)
+            {
+                const std::uint32_t period = tasks[next].periodSlots;
+
+                std::uint32_t bestOffset = 0U;
+                std::uint64_t bestPeak = std::numeric_limits<std::uint64_t>::max();
+
+                for (std::uint32_t offset = 0U; offset < period; ++offset)
+                {
+                    std::uint64_t peak = 0U;
+                    bool fits = true;
+
+                    for (std::size_t slot = offset; slot < SlotsPerCycle; slot += period)
+                    {
+                        const std::uint64_t slotLoad = load[slot] + tasks[next].wcetCycles;
+                        peak = (slotLoad > peak) ? slotLoad : peak;
+                        fits = fits && (count[slot] < MaxTasksPerSlot);
+                    }
+
+                    if (fits && (peak < bestPeak))
+                    {
+                        bestPeak = peak;
+                        bestOffset = offset;
+                    }
+                }
+
+                // When no offset has a free task entry, keep offset 0 and report it below.
+                occupy(next, bestOffset);
+            }
+        }
+
+        // Build per-slot lists in declaration order and check limits.
+        for (std::size_t slot = 0U; (slot < SlotsPerCycle) && (plan.error == SynthesisError::NONE); ++slot)
+        {
+            if (count[slot] > MaxTasksPerSlot)
+            {
+                plan.error = SynthesisError::TOO_MANY_TASKS_IN_SLOT;
+            }
+            else if (load[slot] > slotPeriodCycles)
+            {
+                plan.error = SynthesisError::SLOT_BUDGET_EXCEEDED;
+            }
+            else
+            {
+                for (std::size_t i = 0U; i < TaskCount; ++i)
+                {
+                    if ((slot % tasks[i].periodSlots) == offsets[i])
+                    {
+                        plan.taskIds[slot][plan.taskIdCount[slot]] = tasks[i].taskId;
+                        ++plan.taskIdCount[slot];
+                    }
+                }
+
+                plan.budgetCycles[slot] = static_cast<Driver::CycleCpu>(load[slot]);
+            }
+        }
+
+        return plan;
+    }
+
+    /**
+     * @brief Generates the SlotTable of a SlotTableScheduler from task declarations.
+     *
+     * @tparam Scheduler SlotTableScheduler instantiation providing Slot and SlotTable.
+     * @tparam Tasks     std::array<TaskDeclaration, N> with the task set.
+     *
+     * @details
+     * Instantiating this class fails compilation with a descriptive message if the task set
+     * is not schedulable, so a new task either fits or the build breaks. Use as:
+     * @code
+     * static constexpr Scheduler::SlotTable slotTable =
+     *     SlotTableSynthesizer<Scheduler, taskDeclarations>::SLOT_TABLE;
+     * @endcode
+     */
+    template <typename Scheduler, auto Tasks>
+    class SlotTableSynthesizer final
+    {
+    public:
+        SlotTableSynthesizer() = delete;
+        ~SlotTableSynthesizer() = delete;
+        SlotTableSynthesizer(const SlotTableSynthesizer &) = delete;
+        SlotTableSynthesizer &operator=(const SlotTableSynthesizer &) = delete;
+        SlotTableSynthesizer(SlotTableSynthesizer &&) = delete;
+        SlotTableSynthesizer &operator=(SlotTableSynthesizer &&) = delete;
+
+        /// @brief Intermediate placement including the error code.
+        static constexpr auto PLAN =
+            planSlots<Scheduler::SLOTS_PER_CYCLE, Scheduler::MAX_TASKS_PER_SLOT>(Tasks);
+
+        static_assert(PLAN.error != SynthesisError::INVALID_TASK_ID,
+                      "Task declaration uses an invalid TaskId (LAST_NOT_USED or out of range).");
+
+        static_assert(PLAN.error != SynthesisError::DUPLICATE_TASK_ID,
+                      "Each TaskId may be declared only once.");
+
+        static_assert(PLAN.error != SynthesisError::INVALID_PERIOD,
+                      "periodSlots must be non-zero and divide the number of slots per cycle.");
+
+        static_assert(PLAN.error != SynthesisError::INVALID_OFFSET,
+                      "An explicit offsetSlots must be smaller than periodSlots.");
+
+        static_assert(PLAN.error != SynthesisError::TOO_MANY_TASKS_IN_SLOT,
+                      "Task set needs more tasks in one slot than MaxTasksPerSlot allows.");
+
+        static_assert(PLAN.error != SynthesisError::SLOT_BUDGET_EXCEEDED,
+                      "Summed WCET budgets of a slot exceed the 5 ms TIM2 slot period.");
+
+        /// @brief Generated slot table.
+        static constexpr typename Scheduler::SlotTable SLOT_TABLE =
+            []<std::size_t... Slot>(std::index_sequence<Slot...>) consteval
+        {
+            return typename Scheduler::SlotTable{{
+                typename Scheduler::Slot{.taskIds = PLAN.taskIds[Slot],
+                                         .taskIdCount = PLAN.taskIdCount[Slot],
+                                         .budgetCycles = PLAN.budgetCycles[Slot]}...}};
+        }(std::make_index_sequence<Scheduler::SLOTS_PER_CYCLE>{});
+    };
+} // namespace BusinessLogic
@@ -0,0 +1,169 @@
+/**
+ * @file SpscQueue.cppm
+ * @brief Bounded single-producer single-consumer queue.
+ */
+module;
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+export module BusinessLogic.SpscQueue;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief Lock-free bounded queue for exactly one producer and one consumer.
+     *
+     * @tparam T        Element type; must be trivially copyable.
+     * @tparam Capacity Number of elements; must be a power of two.
+     *
+     * @details
+     * The producer only writes head, so push() needs no compare-and-swap and either side may
+     * run in interrupt context. push() rejects new elements while the queue is full;
+     * pushOverwrite() instead evicts the oldest element. Eviction moves tail from the
+     * producer side, so the consumer advances tail with a compare-and-swap and retries if the
+     * element it was copying got evicted meanwhile. Both rejected and evicted elements are
+     * counted. The producer tracks the highest fill level, which shows how close the consumer
+     * came to falling behind.
+     */
+    template <typename T, std::size_t Capacity>
+    class SpscQueue final
+    {
+    public:
+        /// @brief Number of elements the queue can hold.
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        /**
+         * @brief Appends an element. Producer side only.
+         *
+         * @return false if the queue was full and the element was dropped.
+         */
+        auto push(const T &value) noexcept -> bool
+        {
+            const std::uint32_t position = head.load(std::memory_order_relaxed);
+            const std::uint32_t depth = position - tail.load(std::memory_order_acquire);
+            const bool result = (depth < Capacity);
+
+            if (result) [[likely]]
+            {
+                elements[position % Capacity] = value;
+                head.store(position + 1U, std::memory_order_release);
+
+                if ((depth + 1U) > highWater.load(std::memory_order_relaxed))
+                {
+                    highWater.store(depth + 1U, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                dropped.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Appends an element, evicting the oldest one if the queue is full. Producer side only.
+         *
+         * @return false if an element was evicted to make room.
+         */
+        auto pushOverwrite(const T &value) noexcept -> bool
+        {
+            const std::uint32_t position = head.load(std::memory_order_relaxed);
+            std::uint32_t oldest = tail.load(std::memory_order_acquire);
+            bool result = true;
+
+            if ((position - oldest) >= Capacity) [[unlikely]]
+            {
+                // If the consumer popped meanwhile the CAS fails, but then there is room anyway.
+                result = !tail.compare_exchange_strong(oldest, oldest + 1U, std::memory_order_acq_rel);
+
+                if (!result)
+                {
+                    dropped.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+
+            static_cast<void>(push(value));
+
+            return result;
+        }
+
+        /**
+         * @brief Removes the oldest element. Consumer side only.
+         *
+         * @return false if the queue is empty.
+         */
+        [[nodiscard]] auto pop(T &out) noexcept -> bool
+        {
+            bool result = false;
+            bool retry = true;
+
+            while (retry)
+            {
+                std::uint32_t position = tail.load(std::memory_order_acquire);
+
+                if (position == head.load(std::memory_order_acquire))
+                {
+                    retry = false;
+                }
+                else
+                {
+                    out = elements[position % Capacity];
+
+                    // Fails only if pushOverwrite() evicted this element while it was copied.
+                    result = tail.compare_exchange_strong(position, position + 1U, std::memory_order_acq_rel);
+                    retry = !result;
+                }
+            }
+
+            return result;
+        }
+
+        /// @brief Number of queued elements.
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+
+        /// @brief True if push() would reject an element.
+        [[nodiscard]] auto isFull() const noexcept -> bool
+        {
+            return size() >= Capacity;
+        }
+
+        /// @brief True if no element is queued.
+        [[nodiscard]] auto isEmpty() const noexcept -> bool
+        {
+            return size() == 0U;
+        }
+
+        /// @brief Highest number of queued elements observed by push().
+        [[nodiscard]] auto getHighWater() const noexcept -> std::uint32_t
+        {
+            return highWater.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Number of elements rejected or evicted because the queue was full.
+        [[nodiscard]] auto getDropped() const noexcept -> std::uint32_t
+        {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<T, Capacity> elements{};
+        std::atomic<std::uint32_t> head{0U};
+        std::atomic<std::uint32_t> tail{0U};
+        std::atomic<std::uint32_t> highWater{0U};
+        std::atomic<std::uint32_t> dropped{0U};
+
+        static_assert((Capacity != 0U) && ((Capacity & (Capacity - 1U)) == 0U),
+                      "SpscQueue capacity must be a power of two so indices stay valid across 32-bit wrap.");
+
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "SpscQueue elements are copied by assignment and must be trivially copyable.");
+    };
+} // namespace BusinessLogic
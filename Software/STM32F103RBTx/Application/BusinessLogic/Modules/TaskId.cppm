@@ -10,6 +10,62 @@ export namespace BusinessLogic
     {
         MEASUREMENT = 0,
         KEYBOARD = 1,
-        LAST_NOT_USED = 2
+        WIFI_RECORDER = 2,
+        SD_CARD_RECORDER = 3,
+        PULSE_CAPTURE = 4,
+        LAST_NOT_USED = 5
     };
-}
\ No newline at end of file
+
+    /**
+     * @brief How a task is treated when the scheduler is catching up on a backlog.
+     *
+     * @details
+     * When more slots are pending than SlotTableScheduler::Config::maxCatchUpPerCall, the
+     * scheduler enters load-shedding mode and runs each pending slot with reduced work until
+     * it is back in real time.
+     */
+    enum class TaskCriticality : std::uint8_t
+    {
+        /// @brief Runs in every slot it is scheduled in, also while shedding load.
+        CRITICAL = 0,
+
+        /// @brief Runs at most once per runPending() call while shedding load.
+        COALESCIBLE,
+
+        /// @brief Skipped entirely while shedding load.
+        SHEDDABLE
+    };
+
+    /**
+     * @brief Returns the load-shedding class of a task.
+     *
+     * @details
+     * MEASUREMENT keeps its cadence under backlog. KEYBOARD only needs to observe the latest
+     * key state, so consecutive calls are merged into one. Recorder tasks drain their whole
+     * queue in one call, and PULSE_CAPTURE its whole ring, so one call per catch-up is enough
+     * as well.
+     */
+    [[nodiscard]] constexpr auto getTaskCriticality(TaskId taskId) noexcept -> TaskCriticality
+    {
+        TaskCriticality result = TaskCriticality::SHEDDABLE;
+
+        switch (taskId)
+        {
+        case TaskId::MEASUREMENT:
+            result = TaskCriticality::CRITICAL;
+            break;
+
+        case TaskId::KEYBOARD:
+        case TaskId::WIFI_RECORDER:
+        case TaskId::SD_CARD_RECORDER:
+        case TaskId::PULSE_CAPTURE:
+            result = TaskCriticality::COALESCIBLE;
+            break;
+
+        default:
+            break;
+        }
+
+        return result;
+    }
+}
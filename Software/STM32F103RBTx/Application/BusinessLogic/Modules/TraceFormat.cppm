@@ -0,0 +1,254 @@
+/**
+ * @file TraceFormat.cppm
+ * @brief Scheduler trace records and their binary wire format.
+ *
+ * Shared by the firmware (hardware and simulation builds) and the host-side trace decoder,
+ * so both ends agree on the layout.
+ */
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+export module BusinessLogic.TraceFormat;
+
+import Driver.CycleCpu;
+
+export namespace BusinessLogic
+{
+    /**
+     * @brief Kind of a trace record.
+     */
+    enum class TraceEventType : std::uint8_t
+    {
+        /// @brief Slot execution started; id = slot index.
+        SLOT_START = 0,
+
+        /// @brief Slot execution ended; id = slot index.
+        SLOT_END,
+
+        /// @brief Task call started; id = TaskId.
+        TASK_START,
+
+        /// @brief Task call ended; id = TaskId, arg = 1 if the task succeeded.
+        TASK_END,
+
+        /// @brief Slot timer interrupt; arg = number of slot periods that elapsed.
+        ISR_TIME_SLOT,
+
+        /// @brief Driver interrupt event that became pending; id = Driver::IsrEvent.
+        ISR_EVENT,
+
+        /// @brief Measurement batch passed to a recorder; id = recorder index, arg = batch size.
+        RECORDER_NOTIFY,
+
+        LAST_NOT_USED
+    };
+
+    /**
+     * @brief One trace entry, timestamped with Driver::CycleClock.
+     */
+    struct TraceRecord final
+    {
+        /// @brief Cycle counter value when the event occurred (wraps modulo 2^32).
+        Driver::CycleCpu timestamp{0U};
+
+        /// @brief Event kind.
+        TraceEventType type{TraceEventType::LAST_NOT_USED};
+
+        /// @brief Event subject (slot, task, event or recorder index).
+        std::uint8_t id{0U};
+
+        /// @brief Event specific argument.
+        std::uint16_t arg{0U};
+    };
+
+    /**
+     * @brief Header of one encoded block of trace records.
+     */
+    struct TraceBlockHeader final
+    {
+        /// @brief Number of records following the header.
+        std::uint16_t recordCount{0U};
+
+        /// @brief Records lost because the ring was full since the previous block.
+        std::uint32_t droppedRecords{0U};
+
+        /// @brief Cycle counter frequency used for the timestamps.
+        std::uint32_t cycleHz{0U};
+    };
+
+    /**
+     * @brief Binary wire format of trace blocks.
+     *
+     * @details
+     * A block is a 16-byte header followed by recordCount records of 8 bytes, all little-endian:
+     * @code
+     * header: 'H' 'D' 'T' 'R' | version u8 | record size u8 | recordCount u16
+     *         | droppedRecords u32 | cycleHz u32
+     * record: timestamp u32 | type u8 | id u8 | arg u16
+     * @endcode
+     * The magic lets the decoder find blocks in a UART stream mixed with other output.
+     */
+    class TraceWire final
+    {
+    public:
+        TraceWire() = delete;
+        ~TraceWire() = delete;
+        TraceWire(const TraceWire &) = delete;
+        TraceWire &operator=(const TraceWire &) = delete;
+        TraceWire(TraceWire &&) = delete;
+        TraceWire &operator=(TraceWire &&) = delete;
+
+        /// @brief Block start marker.
+        static constexpr std::array<std::uint8_t, 4U> MAGIC{'H', 'D', 'T', 'R'};
+
+        /// @brief Format version, incremented on incompatible changes.
+        static constexpr std::uint8_t VERSION{1U};
+
+        /// @brief Encoded header size in bytes.
+        static constexpr std::size_t HEADER_SIZE{16U};
+
+        /// @brief Encoded record size in bytes.
+        static constexpr std::size_t RECORD_SIZE{8U};
+
+        /**
+         * @brief Writes a block header.
+         *
+         * @return HEADER_SIZE, or 0 if @p out is too small.
+         */
+        static constexpr auto encodeHeader(const TraceBlockHeader &header,
+                                           std::span<std::uint8_t> out) noexcept -> std::size_t
+        {
+            std::size_t result = 0U;
+
+            if (out.size() >= HEADER_SIZE) [[likely]]
+            {
+                for (std::size_t i = 0U; i < MAGIC.size(); ++i)
+                {
+                    out[i] = MAGIC[i];
+                }
+
+                out[4U] = VERSION;
+                out[5U] = static_cast<std::uint8_t>(RECORD_SIZE);
+                putLe16(out.subspan(6U), header.recordCount);
+                putLe32(out.subspan(8U), header.droppedRecords);
+                putLe32(out.subspan(12U), header.cycleHz);
+
+                result = HEADER_SIZE;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Writes one record.
+         *
+         * @return RECORD_SIZE, or 0 if @p out is too small.
+         */
+        static constexpr auto encodeRecord(const TraceRecord &record,
+                                           std::span<std::uint8_t> out) noexcept -> std::size_t
+        {
+            std::size_t result = 0U;
+
+            if (out.size() >= RECORD_SIZE) [[likely]]
+            {
+                putLe32(out, record.timestamp);
+                out[4U] = std::to_underlying(record.type);
+                out[5U] = record.id;
+                putLe16(out.subspan(6U), record.arg);
+
+                result = RECORD_SIZE;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Parses a block header.
+         *
+         * @return false if @p in is too short, the magic does not match or the version or
+         *         record size is unsupported.
+         */
+        static constexpr auto decodeHeader(std::span<const std::uint8_t> in,
+                                           TraceBlockHeader &header) noexcept -> bool
+        {
+            bool result = (in.size() >= HEADER_SIZE);
+
+            for (std::size_t i = 0U; result && (i < MAGIC.size()); ++i)
+            {
+                result = (in[i] == MAGIC[i]);
+            }
+
+            if (result)
+            {
+                result = (in[4U] == VERSION) && (in[5U] == RECORD_SIZE);
+            }
+
+            if (result)
+            {
+                header.recordCount = getLe16(in.subspan(6U));
+                header.droppedRecords = getLe32(in.subspan(8U));
+                header.cycleHz = getLe32(in.subspan(12U));
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Parses one record; @p in must hold at least RECORD_SIZE bytes.
+         */
+        static constexpr auto decodeRecord(std::span<const std::uint8_t> in) noexcept -> TraceRecord
+        {
+            TraceRecord result{};
+
+            if (in.size() >= RECORD_SIZE) [[likely]]
+            {
+                result.timestamp = getLe32(in);
+                result.type = static_cast<TraceEventType>(in[4U]);
+                result.id = in[5U];
+                result.arg = getLe16(in.subspan(6U));
+            }
+
+            return result;
+        }
+
+    private:
+        static constexpr auto putLe16(std::span<std::uint8_t> out, std::uint16_t value) noexcept -> void
+        {
+            out[0U] = static_cast<std::uint8_t>(value);
+            out[1U] = static_cast<std::uint8_t>(value >> 8U);
+        }
+
+        static constexpr auto putLe32(std::span<std::uint8_t> out, std::uint32_t value) noexcept -> void
+        {
+            for (std::size_t i = 0U; i < 4U; ++i)
+            {
+                out[i] = static_cast<std::uint8_t>(value >> (8U * i));
+            }
+        }
+
+        [[nodiscard]] static constexpr auto getLe16(std::span<const std::uint8_t> in) noexcept -> std::uint16_t
+        {
+            return static_cast<std::uint16_t>(in[0U] | (in[1U] << 8U));
+        }
+
+        [[nodiscard]] static constexpr auto getLe32(std::span<const std::uint8_t> in) noexcept -> std::uint32_t
+        {
+            std::uint32_t result = 0U;
+
+            for (std::size_t i = 0U; i < 4U; ++i)
+            {
+                result |= (static_cast<std::uint32_t>(in[i]) << (8U * i));
+            }
+
+            return result;
+        }
+    };
+
+    static_assert(sizeof(TraceRecord) == TraceWire::RECORD_SIZE,
+                  "TraceRecord is expected to be 8 bytes so the ring stays compact.");
+} // namespace BusinessLogic
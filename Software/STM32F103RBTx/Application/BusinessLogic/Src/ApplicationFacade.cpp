@@ -2,20 +2,31 @@ module;
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <span>
+#include <string_view>
 #include <utility>
 
 module BusinessLogic.ApplicationFacade;
 
 import BusinessLogic.ApplicationComponent;
+import BusinessLogic.BackgroundJob;
 import BusinessLogic.MeasurementCoordinator;
 import BusinessLogic.SlotTableScheduler;
+import BusinessLogic.SchedulerProfiler;
+import BusinessLogic.SchedulerTrace;
 import BusinessLogic.TaskId;
 import BusinessLogic.TickDelegate;
 
 import Device;
 
+import Driver.CycleClock;
 import Driver.PlatformFactory;
+import Driver.PulseCounterDriver;
+import Driver.UartDriver;
+import Driver.UartStatus;
+import Driver.IsrEvent;
 
 namespace BusinessLogic
 {
@@ -25,7 +36,16 @@ namespace BusinessLogic
     static_assert(std::to_underlying(TaskId::KEYBOARD) == 1U,
                   "TaskId is used as an index into TaskCallTable, KEYBOARD must map to index 1.");
 
-    static_assert(std::to_underlying(TaskId::LAST_NOT_USED) == 2U,
+    static_assert(std::to_underlying(TaskId::WIFI_RECORDER) == 2U,
+                  "TaskId is used as an index into TaskCallTable, WIFI_RECORDER must map to index 2.");
+
+    static_assert(std::to_underlying(TaskId::SD_CARD_RECORDER) == 3U,
+                  "TaskId is used as an index into TaskCallTable, SD_CARD_RECORDER must map to index 3.");
+
+    static_assert(std::to_underlying(TaskId::PULSE_CAPTURE) == 4U,
+                  "TaskId is used as an index into TaskCallTable, PULSE_CAPTURE must map to index 4.");
+
+    static_assert(std::to_underlying(TaskId::LAST_NOT_USED) == 5U,
                   "LAST_NOT_USED must equal the number of valid TaskId entries (TaskCallTable size).");
 
     ApplicationFacade::ApplicationFacade(Driver::PlatformFactory &drivers) noexcept
@@ -34,40 +54,66 @@ namespace BusinessLogic
           pulseCounter3{Device::MeasurementDeviceId::PULSE_COUNTER_3, drivers.counter3},
           pulseCounter4{Device::MeasurementDeviceId::PULSE_COUNTER_4, drivers.counter4},
           uartReceiver{Device::MeasurementDeviceId::DEVICE_UART_1, drivers.measurementUart},
+          pulseRate1{Device::MeasurementDeviceId::PULSE_RATE_1, drivers.counter1, PULSE_RATE_UNIT, PULSE_RATE_DEAD_TIME_NS},
+          pulseRate2{Device::MeasurementDeviceId::PULSE_RATE_2, drivers.counter2, PULSE_RATE_UNIT, PULSE_RATE_DEAD_TIME_NS},
+          pulseRate3{Device::MeasurementDeviceId::PULSE_RATE_3, drivers.counter3, PULSE_RATE_UNIT, PULSE_RATE_DEAD_TIME_NS},
+          pulseRate4{Device::MeasurementDeviceId::PULSE_RATE_4, drivers.counter4, PULSE_RATE_UNIT, PULSE_RATE_DEAD_TIME_NS},
+          frequency1{Device::MeasurementDeviceId::FREQUENCY_1, drivers.counter1, FREQUENCY_GATE_MS},
+          frequency2{Device::MeasurementDeviceId::FREQUENCY_2, drivers.counter2, FREQUENCY_GATE_MS},
+          frequency3{Device::MeasurementDeviceId::FREQUENCY_3, drivers.counter3, FREQUENCY_GATE_MS},
+          frequency4{Device::MeasurementDeviceId::FREQUENCY_4, drivers.counter4, FREQUENCY_GATE_MS},
           sources{std::ref(pulseCounter1),
                   std::ref(pulseCounter2),
                   std::ref(pulseCounter3), std::ref(pulseCounter4),
-                  std::ref(uartReceiver)},
+                  std::ref(uartReceiver),
+                  std::ref(pulseRate1), std::ref(pulseRate2),
+                  std::ref(pulseRate3), std::ref(pulseRate4),
+                  std::ref(frequency1), std::ref(frequency2),
+                  std::ref(frequency3), std::ref(frequency4)},
           wifiRecorder{drivers.wifiUart},
           sdCardRecorder{drivers.sdCard},
           recorders{std::ref(wifiRecorder),
                     std::ref(sdCardRecorder)},
-          measurement{sources, recorders},
+          measurement{sources, recorders, reportPolicies, overflowPolicies},
+          pulseCapture{drivers.counter3},
+          sdCardTask{*this, measurement, sdCardRecorder},
           display{drivers.display},
           brightness{drivers.lightSensor, drivers.displayBrightness},
           keyboard{drivers.keyboard},
           taskCallTable{TickDelegate(measurement),
-                        TickDelegate(keyboard)},
-          scheduler{Scheduler::Config{slotTable, taskCallTable, 2U}}
+                        TickDelegate(keyboard),
+                        TickDelegate(measurement.getRecorderTask(WIFI_RECORDER_INDEX)),
+                        TickDelegate(sdCardTask),
+                        TickDelegate(pulseCapture)},
+          scheduler{Scheduler::Config{slotTable, taskCallTable, 2U, 8U, taskTriggers, backgroundWindowCycles}},
+          usbUart{drivers.usbUart}
     {
         static_assert(taskCallTable.size() == std::to_underlying(TaskId::LAST_NOT_USED),
                       "TaskCallTable size must match the number of TaskId entries.");
-
-        static_assert(ApplicationFacade::validateSlotTable(),
-                      "slotTable is invalid: taskIdCount exceeds maxTasksPerSlot and/or contains invalid TaskId values.");
     }
 
     auto ApplicationFacade::onInit() noexcept -> bool
     {
+        // Once, before any component reads it: sources, gates and the scheduler share this time line.
+        Driver::CycleClock::init();
+
         const bool statusMeasurement = measurement.init();
         const bool statusDisplay = display.init();
         const bool statusBrightness = brightness.init();
         const bool statusKeyboard = keyboard.init();
 
+        bool statusDiagnostics = true;
+
+        if constexpr (DIAGNOSTICS_UART_ENABLED)
+        {
+            statusDiagnostics = usbUart.init();
+        }
+
         const bool status = (statusMeasurement &&
                              statusDisplay &&
                              statusBrightness &&
-                             statusKeyboard);
+                             statusKeyboard &&
+                             statusDiagnostics);
 
         return status;
     }
@@ -75,16 +121,41 @@ namespace BusinessLogic
     auto ApplicationFacade::onStart() noexcept -> bool
     {
         const bool statusMeasurement = measurement.start();
+
+        bool statusGate = true;
+
+        if constexpr (PULSE_GATE_PERIOD_MS != 0U)
+        {
+            statusGate = Driver::PulseCounterDriver::startGatedSampling(PULSE_GATE_PERIOD_MS);
+        }
+
+        bool statusCapture = true;
+
+        if constexpr (PULSE_CAPTURE_ENABLED)
+        {
+            statusCapture = pulseCapture.start(PULSE_CAPTURE_TICK_HZ);
+        }
+
         const bool statusDisplay = display.start();
         const bool statusBrightness = brightness.start();
         const bool statusKeyboard = keyboard.start();
         const bool statusScheduler = scheduler.start();
 
+        bool statusDiagnostics = true;
+
+        if constexpr (DIAGNOSTICS_UART_ENABLED)
+        {
+            statusDiagnostics = usbUart.start();
+        }
+
         const bool status = (statusMeasurement &&
+                             statusGate &&
+                             statusCapture &&
                              statusDisplay &&
                              statusBrightness &&
                              statusKeyboard &&
-                             statusScheduler);
+                             statusScheduler &&
+                             statusDiagnostics);
 
         //        return status;
         return true;
@@ -92,6 +163,16 @@ namespace BusinessLogic
 
     auto ApplicationFacade::onStop() noexcept -> bool
     {
+        if constexpr (PULSE_GATE_PERIOD_MS != 0U)
+        {
+            Driver::PulseCounterDriver::stopGatedSampling();
+        }
+
+        if constexpr (PULSE_CAPTURE_ENABLED)
+        {
+            pulseCapture.stop();
+        }
+
         const bool statusMeasurement = measurement.stop();
         const bool statusDisplay = display.stop();
         const bool statusBrightness = brightness.stop();
@@ -115,4 +196,122 @@ namespace BusinessLogic
         scheduler.notifyTimeSlotIsr();
     }
 
-} // namespace BusinessLogic
\ No newline at end of file
+    auto ApplicationFacade::onTimeSlotsElapsed(std::uint32_t elapsedSlots) noexcept -> void
+    {
+        scheduler.notifyTimeSlotsElapsedIsr(elapsedSlots);
+    }
+
+    auto ApplicationFacade::getIdleSlots(std::uint32_t maxSlots) const noexcept -> std::uint32_t
+    {
+        return scheduler.idleSlotsUntilWork(maxSlots);
+    }
+
+    auto ApplicationFacade::onIsrEvent(Driver::IsrEvent event) noexcept -> void
+    {
+        scheduler.notifyEventIsr(event);
+    }
+
+    auto ApplicationFacade::getSchedulerStatus() const noexcept -> const Status &
+    {
+        return scheduler.getStatus();
+    }
+
+    auto ApplicationFacade::getRecorderQueueStats(std::size_t recorderIndex) const noexcept -> RecorderQueueStats
+    {
+        return measurement.getQueueStats(recorderIndex);
+    }
+
+    auto ApplicationFacade::submitBackgroundJob(BackgroundJob job) noexcept -> bool
+    {
+        return scheduler.submitJob(job);
+    }
+
+    auto ApplicationFacade::getCaptureHistogram() const noexcept -> const Device::InterArrivalHistogram &
+    {
+        return pulseCapture.getHistogram();
+    }
+
+    auto ApplicationFacade::dumpSchedulerProfile() noexcept -> bool
+    {
+        bool status = false;
+
+        if constexpr (SchedulerProfiler::ENABLED)
+        {
+            std::array<char, SchedulerProfileReport::LINE_BUFFER_SIZE> line{};
+
+            const auto sendLine = [&](std::string_view label,
+                                      std::size_t index,
+                                      const CycleStats &stats) noexcept -> bool
+            {
+                const std::size_t length =
+                    SchedulerProfileReport::formatLine(label, index, stats, std::span{line});
+
+                bool sent = false;
+
+                if (length != 0U) [[likely]]
+                {
+                    const std::span<const std::uint8_t> data{
+                        reinterpret_cast<const std::uint8_t *>(line.data()),
+                        length};
+
+                    sent = (usbUart.transmit(data, PROFILE_TX_TIMEOUT_MS) == Driver::UartStatus::Ok);
+                }
+
+                return sent;
+            };
+
+            const SchedulerProfiler::Snapshot &profile = scheduler.getProfiler().snapshot();
+
+            status = true;
+
+            for (std::size_t i = 0U; i < profile.tasks.size(); ++i)
+            {
+                status = sendLine("task", i, profile.tasks[i]) && status;
+            }
+
+            for (std::size_t i = 0U; i < profile.slots.size(); ++i)
+            {
+                status = sendLine("slot", i, profile.slots[i]) && status;
+            }
+
+            status = sendLine("latency", 0U, scheduler.getStatus().dispatchLatency) && status;
+        }
+
+        return status;
+    }
+
+    auto ApplicationFacade::dumpTrace() noexcept -> bool
+    {
+        bool status = false;
+
+        if constexpr (TRACE_ENABLED)
+        {
+            std::array<std::uint8_t, SchedulerTrace::BLOCK_SIZE> block{};
+
+            bool more = true;
+            status = true;
+
+            // Bounded so a trace refilled by interrupts cannot keep the main loop here.
+            for (std::size_t i = 0U; more && (i < MAX_TRACE_BLOCKS_PER_DUMP); ++i)
+            {
+                const std::size_t length = SchedulerTrace::readBlock(block);
+                more = (length != 0U);
+
+                if (more)
+                {
+                    status = (usbUart.transmit(std::span{block}.first(length), TRACE_TX_TIMEOUT_MS) ==
+                              Driver::UartStatus::Ok) &&
+                             status;
+                }
+            }
+        }
+
+        return status;
+    }
+
+    auto ApplicationFacade::readTrace(std::span<std::uint8_t> buffer) noexcept -> std::size_t
+    {
+        return SchedulerTrace::readBlock(buffer);
+    }
+
+} // namespace BusinessLogic
@@ -6,10 +6,14 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <variant>
 
 import BusinessLogic.MeasurementCoordinator;
+import BusinessLogic.MeasurementPipeline;
+import BusinessLogic.MeasurementRouting;
+import BusinessLogic.ReportFilter;
 import Device;
 
 // Mock classes - must match actual interface signatures including noexcept
@@ -90,6 +94,20 @@ protected:
     auto getMockRecorder2() -> MockMeasurementRecorder * { return mockRecorder2.get(); }
     auto getCoordinator() -> CoordinatorType * { return coordinator.get(); }
 
+    auto drainAll() -> bool
+    {
+        const bool first = coordinator->drainRecorder(0U);
+        const bool second = coordinator->drainRecorder(1U);
+        return first && second;
+    }
+
+    auto makeMeasurement(std::uint32_t value) -> Device::MeasurementType
+    {
+        return Device::MeasurementType{
+            .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+            .data = value};
+    }
+
 private:
     std::unique_ptr<MockMeasurementSource> mockSource1;
     std::unique_ptr<MockMeasurementSource> mockSource2;
@@ -295,6 +313,7 @@ TEST_F(MeasurementCoordinatorTest, Tick_NoMeasurementsAvailable_NoRecordersNotif
     const bool result = getCoordinator()->onTick();
 
     EXPECT_TRUE(result);
+    EXPECT_TRUE(drainAll());
 }
 
 TEST_F(MeasurementCoordinatorTest, Tick_OneMeasurementAvailable_AllRecordersNotified)
@@ -315,6 +334,7 @@ TEST_F(MeasurementCoordinatorTest, Tick_OneMeasurementAvailable_AllRecordersNoti
     const bool result = getCoordinator()->onTick();
 
     EXPECT_TRUE(result);
+    EXPECT_TRUE(drainAll());
 }
 
 TEST_F(MeasurementCoordinatorTest, Tick_BothMeasurementsAvailable_AllRecordersNotifiedTwice)
@@ -341,6 +361,7 @@ TEST_F(MeasurementCoordinatorTest, Tick_BothMeasurementsAvailable_AllRecordersNo
     const bool result = getCoordinator()->onTick();
 
     EXPECT_TRUE(result);
+    EXPECT_TRUE(drainAll());
 }
 
 TEST_F(MeasurementCoordinatorTest, MultipleTicks_HandlesMultipleCycles)
@@ -371,9 +392,79 @@ TEST_F(MeasurementCoordinatorTest, MultipleTicks_HandlesMultipleCycles)
         .Times(2)
         .WillRepeatedly(testing::Return(true));
 
+    for (int tick = 0; tick < 3; ++tick)
+    {
+        EXPECT_TRUE(getCoordinator()->onTick());
+        EXPECT_TRUE(drainAll());
+    }
+}
+
+// ==================== Recorder Queue Tests ====================
+
+TEST_F(MeasurementCoordinatorTest, Tick_QueuesUntilRecorderDrained)
+{
+    EXPECT_CALL(*getMockSource1(), isMeasurementAvailable()).WillOnce(testing::Return(true));
+    EXPECT_CALL(*getMockSource1(), getMeasurement()).WillOnce(testing::Return(makeMeasurement(7U)));
+    EXPECT_CALL(*getMockSource2(), isMeasurementAvailable()).WillOnce(testing::Return(false));
+
+    EXPECT_CALL(*getMockRecorder1(), notify(testing::_)).Times(0);
+    EXPECT_CALL(*getMockRecorder2(), notify(testing::_)).Times(0);
+
     EXPECT_TRUE(getCoordinator()->onTick());
+    EXPECT_EQ(getCoordinator()->getQueueStats(0U).depth, 1U);
+    EXPECT_EQ(getCoordinator()->getQueueStats(1U).depth, 1U);
+
+    testing::Mock::VerifyAndClearExpectations(getMockRecorder1());
+
+    EXPECT_CALL(*getMockRecorder1(), notify(testing::_)).WillOnce(testing::Return(true));
+    EXPECT_TRUE(getCoordinator()->getRecorderTask(0U).tick());
+    EXPECT_EQ(getCoordinator()->getQueueStats(0U).depth, 0U);
+    EXPECT_EQ(getCoordinator()->getQueueStats(1U).depth, 1U); // other recorder keeps its own pace
+}
+
+TEST_F(MeasurementCoordinatorTest, Drain_RecorderFails_OtherRecorderUnaffected)
+{
+    EXPECT_CALL(*getMockSource1(), isMeasurementAvailable()).WillOnce(testing::Return(true));
+    EXPECT_CALL(*getMockSource1(), getMeasurement()).WillOnce(testing::Return(makeMeasurement(7U)));
+    EXPECT_CALL(*getMockSource2(), isMeasurementAvailable()).WillOnce(testing::Return(false));
+
+    EXPECT_CALL(*getMockRecorder1(), notify(testing::_)).WillOnce(testing::Return(false));
+    EXPECT_CALL(*getMockRecorder2(), notify(testing::_)).WillOnce(testing::Return(true));
+
     EXPECT_TRUE(getCoordinator()->onTick());
-    EXPECT_TRUE(getCoordinator()->onTick());
+    EXPECT_FALSE(getCoordinator()->drainRecorder(0U));
+    EXPECT_TRUE(getCoordinator()->drainRecorder(1U));
+}
+
+TEST_F(MeasurementCoordinatorTest, Tick_StalledRecorder_DropsOnlyItsMeasurements)
+{
+    constexpr std::size_t TICKS = CoordinatorType::QUEUE_CAPACITY + 2U;
+
+    EXPECT_CALL(*getMockSource1(), isMeasurementAvailable()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*getMockSource1(), getMeasurement()).WillRepeatedly(testing::Return(makeMeasurement(7U)));
+    EXPECT_CALL(*getMockSource2(), isMeasurementAvailable()).WillRepeatedly(testing::Return(false));
+
+    EXPECT_CALL(*getMockRecorder1(), notify(testing::_)).Times(TICKS).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*getMockRecorder2(), notify(testing::_)).Times(0);
+
+    std::size_t failedTicks = 0U;
+
+    for (std::size_t tick = 0U; tick < TICKS; ++tick)
+    {
+        failedTicks += getCoordinator()->onTick() ? 0U : 1U;
+        EXPECT_TRUE(getCoordinator()->drainRecorder(0U));
+    }
+
+    EXPECT_EQ(failedTicks, 2U);
+
+    const BusinessLogic::RecorderQueueStats fast = getCoordinator()->getQueueStats(0U);
+    EXPECT_EQ(fast.highWater, 1U);
+    EXPECT_EQ(fast.dropped, 0U);
+
+    const BusinessLogic::RecorderQueueStats stalled = getCoordinator()->getQueueStats(1U);
+    EXPECT_EQ(stalled.depth, CoordinatorType::QUEUE_CAPACITY);
+    EXPECT_EQ(stalled.highWater, CoordinatorType::QUEUE_CAPACITY);
+    EXPECT_EQ(stalled.dropped, 2U);
 }
 
 // ==================== Test with Many Sources/Recorders ====================
@@ -457,4 +548,346 @@ private:
     std::unique_ptr<RecorderArray> recorders;
 
     std::unique_ptr<CoordinatorType> coordinator;
-};
\ No newline at end of file
+};
+// ==================== Batch Recorder Tests ====================
+
+namespace
+{
+    class BatchRecorder
+    {
+    public:
+        auto init() noexcept -> bool { return true; }
+        auto start() noexcept -> bool { return true; }
+        auto stop() noexcept -> bool { return true; }
+
+        auto notify(const Device::MeasurementType &) noexcept -> bool
+        {
+            ++singleCalls;
+            return true;
+        }
+
+        auto notifyBatch(Device::MeasurementColumns measurements) noexcept -> bool
+        {
+            batchSizes.push_back(measurements.size());
+
+            for (std::size_t index = 0U; index < measurements.size(); ++index)
+            {
+                received.push_back(Device::toMeasurement(measurements.getRecord(index)));
+            }
+
+            return accept;
+        }
+
+        bool accept{true};
+        std::size_t singleCalls{0U};
+        std::vector<std::size_t> batchSizes;
+        std::vector<Device::MeasurementType> received;
+    };
+}
+
+TEST(MeasurementCoordinatorBatchTest, Drain_CollectsSeveralTicksIntoOneBatch)
+{
+    using SourceArray = std::array<std::variant<std::reference_wrapper<MockMeasurementSource>>, 2U>;
+    using RecorderArray = std::array<std::variant<std::reference_wrapper<BatchRecorder>>, 1U>;
+
+    testing::NiceMock<MockMeasurementSource> source1;
+    testing::NiceMock<MockMeasurementSource> source2;
+    BatchRecorder recorder;
+
+    SourceArray sources{{std::ref(source1), std::ref(source2)}};
+    RecorderArray recorders{{std::ref(recorder)}};
+    BusinessLogic::MeasurementCoordinator<SourceArray, RecorderArray> coordinator{sources, recorders};
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint32_t{1U}};
+
+    ON_CALL(source1, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source1, getMeasurement()).WillByDefault(testing::Return(measurement));
+    ON_CALL(source2, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source2, getMeasurement()).WillByDefault(testing::Return(measurement));
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+
+    ASSERT_EQ(recorder.batchSizes.size(), 1U);
+    EXPECT_EQ(recorder.batchSizes[0], 4U);
+    EXPECT_EQ(recorder.singleCalls, 0U);
+
+    // Empty queue: the recorder is not called at all.
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+    EXPECT_EQ(recorder.batchSizes.size(), 1U);
+}
+
+// ==================== Report-by-Exception Tests ====================
+
+TEST(MeasurementCoordinatorReportTest, OnChange_UnchangedMeasurementsNotQueued)
+{
+    using SourceArray = std::array<std::variant<std::reference_wrapper<MockMeasurementSource>>, 1U>;
+    using RecorderArray = std::array<std::variant<std::reference_wrapper<BatchRecorder>>, 1U>;
+
+    constexpr BusinessLogic::ReportPolicyTable policies{
+        BusinessLogic::ReportPolicy{.mode = BusinessLogic::ReportMode::ON_CHANGE, .deadband = 0U, .heartbeatTicks = 0U}};
+
+    testing::NiceMock<MockMeasurementSource> source;
+    BatchRecorder recorder;
+
+    SourceArray sources{{std::ref(source)}};
+    RecorderArray recorders{{std::ref(recorder)}};
+    BusinessLogic::MeasurementCoordinator<SourceArray, RecorderArray> coordinator{sources, recorders, policies};
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint32_t{3U}};
+
+    ON_CALL(source, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source, getMeasurement()).WillByDefault(testing::Return(measurement));
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+
+    EXPECT_EQ(coordinator.getQueueStats(0U).depth, 1U);
+    EXPECT_EQ(coordinator.getSuppressedCount(Device::MeasurementDeviceId::PULSE_COUNTER_1), 2U);
+}
+
+// ==================== Routing Tests ====================
+
+TEST(MeasurementCoordinatorRoutingTest, Tick_QueuesOnlyRoutedPairs)
+{
+    using SourceArray = std::array<std::variant<std::reference_wrapper<MockMeasurementSource>>, 3U>;
+    using RecorderArray = std::array<std::variant<std::reference_wrapper<BatchRecorder>>, 2U>;
+    using Routing = BusinessLogic::RoutingTable<3U, 2U>;
+
+    // Source 0 feeds both recorders, source 1 only recorder 1, source 2 nothing.
+    constexpr Routing ROUTING{{Routing::ALL_RECORDERS, BusinessLogic::recorderBit(1U), 0U}};
+
+    testing::NiceMock<MockMeasurementSource> source1;
+    testing::NiceMock<MockMeasurementSource> source2;
+    testing::StrictMock<MockMeasurementSource> unrouted;
+    BatchRecorder recorder1;
+    BatchRecorder recorder2;
+
+    SourceArray sources{{std::ref(source1), std::ref(source2), std::ref(unrouted)}};
+    RecorderArray recorders{{std::ref(recorder1), std::ref(recorder2)}};
+    BusinessLogic::MeasurementCoordinator<SourceArray, RecorderArray, 8U, ROUTING> coordinator{sources, recorders};
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint32_t{1U}};
+
+    ON_CALL(source1, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source1, getMeasurement()).WillByDefault(testing::Return(measurement));
+    ON_CALL(source2, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source2, getMeasurement()).WillByDefault(testing::Return(measurement));
+
+    // A StrictMock fails the test if the unrouted source is polled.
+    EXPECT_TRUE(coordinator.onTick());
+
+    EXPECT_EQ(coordinator.getQueueStats(0U).depth, 1U);
+    EXPECT_EQ(coordinator.getQueueStats(1U).depth, 2U);
+}
+
+TEST(MeasurementCoordinatorPipelineTest, Tick_AppliesPipelineOfEachSource)
+{
+    using SourceArray = std::array<std::variant<std::reference_wrapper<MockMeasurementSource>>, 2U>;
+    using RecorderArray = std::array<std::variant<std::reference_wrapper<BatchRecorder>>, 1U>;
+    using Pipelines = BusinessLogic::PipelineSet<
+        BusinessLogic::Pipeline<BusinessLogic::ScaleStage<10U, 1U>, BusinessLogic::DecimateStage<2U>>>;
+
+    testing::NiceMock<MockMeasurementSource> source1;
+    testing::NiceMock<MockMeasurementSource> source2;
+    BatchRecorder recorder;
+
+    SourceArray sources{{std::ref(source1), std::ref(source2)}};
+    RecorderArray recorders{{std::ref(recorder)}};
+    BusinessLogic::MeasurementCoordinator<SourceArray,
+                                          RecorderArray,
+                                          8U,
+                                          BusinessLogic::RoutingTable<2U, 1U>::all(),
+                                          Pipelines>
+        coordinator{sources, recorders};
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint32_t{3U}};
+
+    ON_CALL(source1, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source1, getMeasurement()).WillByDefault(testing::Return(measurement));
+    ON_CALL(source2, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+    ON_CALL(source2, getMeasurement()).WillByDefault(testing::Return(measurement));
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+
+    // Source 1: scaled, every second one dropped. Source 2: no pipeline.
+    EXPECT_EQ(coordinator.getQueueStats(0U).depth, 3U);
+}
+
+// ==================== Overflow Policy Tests ====================
+
+namespace
+{
+    using OverflowSourceArray = std::array<std::variant<std::reference_wrapper<MockMeasurementSource>>, 1U>;
+    using OverflowRecorderArray = std::array<std::variant<std::reference_wrapper<BatchRecorder>>, 1U>;
+    using OverflowCoordinator = BusinessLogic::MeasurementCoordinator<OverflowSourceArray, OverflowRecorderArray, 2U>;
+
+    /// Makes the source return 1, 2, 3, ... on consecutive calls.
+    auto countUp(MockMeasurementSource &source) -> void
+    {
+        ON_CALL(source, isMeasurementAvailable()).WillByDefault(testing::Return(true));
+        ON_CALL(source, getMeasurement())
+            .WillByDefault(
+                [value = std::uint32_t{0U}]() mutable noexcept
+                {
+                    return Device::MeasurementType{.source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+                                                   .data = std::uint32_t{++value}};
+                });
+    }
+
+    auto valuesOf(const std::vector<Device::MeasurementType> &measurements) -> std::vector<std::uint32_t>
+    {
+        std::vector<std::uint32_t> result;
+
+        for (const auto &measurement : measurements)
+        {
+            result.push_back(std::get<std::uint32_t>(measurement.data));
+        }
+
+        return result;
+    }
+}
+
+TEST(MeasurementCoordinatorOverflowTest, DropNewest_KeepsOldestAndCountsDrops)
+{
+    testing::NiceMock<MockMeasurementSource> source;
+    BatchRecorder recorder;
+
+    OverflowSourceArray sources{{std::ref(source)}};
+    OverflowRecorderArray recorders{{std::ref(recorder)}};
+    OverflowCoordinator coordinator{sources, recorders};
+
+    countUp(source);
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_FALSE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+
+    EXPECT_EQ(valuesOf(recorder.received), (std::vector<std::uint32_t>{1U, 2U}));
+
+    const BusinessLogic::RecorderQueueStats stats = coordinator.getQueueStats(0U);
+    EXPECT_EQ(stats.dropped, 1U);
+    EXPECT_EQ(stats.delivered, 2U);
+    EXPECT_EQ(stats.coalesced, 0U);
+}
+
+TEST(MeasurementCoordinatorOverflowTest, RejectedBatch_IsCountedAndNotRetried)
+{
+    testing::NiceMock<MockMeasurementSource> source;
+    BatchRecorder recorder;
+
+    OverflowSourceArray sources{{std::ref(source)}};
+    OverflowRecorderArray recorders{{std::ref(recorder)}};
+    OverflowCoordinator coordinator{sources, recorders};
+
+    countUp(source);
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+
+    recorder.accept = false;
+    EXPECT_FALSE(coordinator.drainRecorder(0U));
+
+    recorder.accept = true;
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+
+    EXPECT_EQ(recorder.batchSizes, (std::vector<std::size_t>{2U, 1U}));
+
+    const BusinessLogic::RecorderQueueStats stats = coordinator.getQueueStats(0U);
+    EXPECT_EQ(stats.depth, 0U);
+    EXPECT_EQ(stats.rejected, 2U);
+    EXPECT_EQ(stats.delivered, 1U);
+    EXPECT_EQ(stats.dropped, 0U);
+}
+
+TEST(MeasurementCoordinatorOverflowTest, DropOldest_KeepsNewestAndLeavesSequenceGap)
+{
+    testing::NiceMock<MockMeasurementSource> source;
+    BatchRecorder recorder;
+
+    OverflowSourceArray sources{{std::ref(source)}};
+    OverflowRecorderArray recorders{{std::ref(recorder)}};
+    OverflowCoordinator coordinator{sources,
+                                    recorders,
+                                    BusinessLogic::REPORT_ALWAYS,
+                                    {BusinessLogic::OverflowPolicy::DROP_OLDEST}};
+
+    countUp(source);
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_FALSE(coordinator.onTick());
+    EXPECT_FALSE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+
+    ASSERT_EQ(valuesOf(recorder.received), (std::vector<std::uint32_t>{3U, 4U}));
+    EXPECT_EQ(recorder.received[0].sequence, 2U);
+    EXPECT_EQ(recorder.received[1].sequence, 3U);
+
+    const BusinessLogic::RecorderQueueStats stats = coordinator.getQueueStats(0U);
+    EXPECT_EQ(stats.dropped, 2U);
+    EXPECT_EQ(stats.delivered, 2U);
+}
+
+TEST(MeasurementCoordinatorOverflowTest, CoalesceLatest_ReplacesParkedValueAndFlushesLater)
+{
+    testing::NiceMock<MockMeasurementSource> source;
+    BatchRecorder recorder;
+
+    OverflowSourceArray sources{{std::ref(source)}};
+    OverflowRecorderArray recorders{{std::ref(recorder)}};
+    OverflowCoordinator coordinator{sources,
+                                    recorders,
+                                    BusinessLogic::REPORT_ALWAYS,
+                                    {BusinessLogic::OverflowPolicy::COALESCE_LATEST}};
+
+    countUp(source);
+
+    // 1 and 2 fill the queue, 3 and 4 are replaced by 5 while waiting.
+    for (std::size_t tick = 0U; tick < 5U; ++tick)
+    {
+        EXPECT_TRUE(coordinator.onTick());
+    }
+
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+    EXPECT_EQ(valuesOf(recorder.received), (std::vector<std::uint32_t>{1U, 2U}));
+
+    ON_CALL(source, isMeasurementAvailable()).WillByDefault(testing::Return(false));
+
+    EXPECT_TRUE(coordinator.onTick());
+    EXPECT_TRUE(coordinator.drainRecorder(0U));
+
+    ASSERT_EQ(valuesOf(recorder.received), (std::vector<std::uint32_t>{1U, 2U, 5U}));
+    EXPECT_EQ(recorder.received[2].sequence, 4U);
+
+    const BusinessLogic::RecorderQueueStats stats = coordinator.getQueueStats(0U);
+    EXPECT_EQ(stats.dropped, 0U);
+    EXPECT_EQ(stats.coalesced, 2U);
+    EXPECT_EQ(stats.delivered, 3U);
+}
+
+TEST(MeasurementRoutingTest, RoutingTable_AllAndValidity)
+{
+    using Routing = BusinessLogic::RoutingTable<2U, 3U>;
+
+    static_assert(Routing::ALL_RECORDERS == 0b111U);
+    static_assert(Routing::all().isRouted(1U, 2U));
+    static_assert(Routing::all().isValid());
+    static_assert(!Routing{{BusinessLogic::recorderBit(3U), 0U}}.isValid());
+    static_assert(BusinessLogic::RoutingTable<1U, 32U>::ALL_RECORDERS == 0xFFFF'FFFFU);
+
+    EXPECT_FALSE((Routing{{BusinessLogic::recorderBit(0U), 0U}}.isRouted(1U, 0U)));
+}
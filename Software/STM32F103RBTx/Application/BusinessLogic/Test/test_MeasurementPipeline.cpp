@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <variant>
+
+import BusinessLogic.MeasurementPipeline;
+import Device;
+
+namespace
+{
+    using BusinessLogic::DeadbandStage;
+    using BusinessLogic::DecimateStage;
+    using BusinessLogic::MovingAverageStage;
+    using BusinessLogic::Pipeline;
+    using BusinessLogic::PipelineSet;
+    using BusinessLogic::ScaleStage;
+
+    auto makeMeasurement(std::uint32_t value) -> Device::MeasurementType
+    {
+        return Device::MeasurementType{.source = Device::MeasurementDeviceId::PULSE_COUNTER_1, .data = value};
+    }
+
+    /// Runs one value through a pipeline; returns the output or UINT32_MAX if dropped.
+    template <typename P>
+    auto run(P &pipeline, std::uint32_t value) -> std::uint32_t
+    {
+        Device::MeasurementType measurement = makeMeasurement(value);
+
+        return pipeline.process(measurement) ? std::get<std::uint32_t>(measurement.data) : UINT32_MAX;
+    }
+
+    static_assert(sizeof(Pipeline<>) == 1U, "An empty pipeline must not carry state.");
+    static_assert(sizeof(PipelineSet<>) == 1U, "An empty pipeline set must not carry state.");
+}
+
+TEST(MeasurementPipelineTest, EmptyPipeline_PassesUnchanged)
+{
+    Pipeline<> pipeline;
+
+    EXPECT_EQ(run(pipeline, 42U), 42U);
+}
+
+TEST(MeasurementPipelineTest, Scale_ConvertsAndKeepsAlternative)
+{
+    Pipeline<ScaleStage<3U, 2U>> pipeline;
+
+    EXPECT_EQ(run(pipeline, 10U), 15U);
+
+    Device::MeasurementType narrow{.source = Device::MeasurementDeviceId::DEVICE_UART_1,
+                                   .data = std::uint16_t{50'000U}};
+    ASSERT_TRUE(pipeline.process(narrow));
+    ASSERT_TRUE(std::holds_alternative<std::uint16_t>(narrow.data));
+    EXPECT_EQ(std::get<std::uint16_t>(narrow.data), UINT16_MAX); // saturates
+}
+
+TEST(MeasurementPipelineTest, Decimate_PassesEveryNth)
+{
+    Pipeline<DecimateStage<3U>> pipeline;
+
+    EXPECT_EQ(run(pipeline, 1U), 1U);
+    EXPECT_EQ(run(pipeline, 2U), UINT32_MAX);
+    EXPECT_EQ(run(pipeline, 3U), UINT32_MAX);
+    EXPECT_EQ(run(pipeline, 4U), 4U);
+}
+
+TEST(MeasurementPipelineTest, MovingAverage_AveragesOverWindow)
+{
+    Pipeline<MovingAverageStage<4U>> pipeline;
+
+    EXPECT_EQ(run(pipeline, 4U), 4U);
+    EXPECT_EQ(run(pipeline, 8U), 6U);
+    EXPECT_EQ(run(pipeline, 0U), 4U);
+    EXPECT_EQ(run(pipeline, 12U), 6U);
+    EXPECT_EQ(run(pipeline, 20U), 10U); // first value leaves the window
+}
+
+TEST(MeasurementPipelineTest, Deadband_DropsSmallChanges)
+{
+    Pipeline<DeadbandStage<2U>> pipeline;
+
+    EXPECT_EQ(run(pipeline, 10U), 10U);
+    EXPECT_EQ(run(pipeline, 12U), UINT32_MAX);
+    EXPECT_EQ(run(pipeline, 13U), 13U);
+}
+
+TEST(MeasurementPipelineTest, Chain_StopsAtFirstDrop)
+{
+    Pipeline<DecimateStage<2U>, MovingAverageStage<2U>> pipeline;
+
+    EXPECT_EQ(run(pipeline, 10U), 10U);
+    EXPECT_EQ(run(pipeline, 99U), UINT32_MAX); // decimated, never reaches the average
+    EXPECT_EQ(run(pipeline, 20U), 15U);
+}
+
+TEST(MeasurementPipelineTest, PipelineSet_SourcesWithoutPipelinePassUnchanged)
+{
+    PipelineSet<Pipeline<ScaleStage<2U, 1U>>> pipelines;
+    Device::MeasurementType measurement = makeMeasurement(5U);
+
+    ASSERT_TRUE(pipelines.process<0U>(measurement));
+    EXPECT_EQ(std::get<std::uint32_t>(measurement.data), 10U);
+
+    ASSERT_TRUE(pipelines.process<1U>(measurement));
+    EXPECT_EQ(std::get<std::uint32_t>(measurement.data), 10U);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+import BusinessLogic.PulseCaptureTask;
+import Device;
+import Driver.PulseCapture;
+
+namespace
+{
+    class FakeCaptureDriver
+    {
+    public:
+        auto startCapture(std::uint32_t tickHz) noexcept -> bool
+        {
+            startedHz = tickHz;
+            return Driver::isCaptureTickHzValid(tickHz);
+        }
+
+        auto stopCapture() noexcept -> void
+        {
+            stopped = true;
+        }
+
+        auto readCaptures(std::span<Driver::CaptureTick> ticks) noexcept -> std::size_t
+        {
+            const std::size_t count = std::min(ticks.size(), pending.size() - readIndex);
+
+            std::copy_n(pending.begin() + static_cast<std::ptrdiff_t>(readIndex), count, ticks.begin());
+            readIndex += count;
+            return count;
+        }
+
+        auto getLostCaptures() const noexcept -> std::uint32_t
+        {
+            return lost;
+        }
+
+        auto push(std::size_t count, Driver::CaptureTick step) -> void
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                next = static_cast<Driver::CaptureTick>(next + step);
+                pending.push_back(next);
+            }
+        }
+
+        std::vector<Driver::CaptureTick> pending;
+        std::size_t readIndex{0U};
+        Driver::CaptureTick next{0U};
+        std::uint32_t lost{0U};
+        std::uint32_t startedHz{0U};
+        bool stopped{false};
+    };
+
+    constexpr std::uint32_t TICK_HZ{1'000'000U};
+}
+
+TEST(PulseCaptureTaskTest, Start_RejectsInvalidRate)
+{
+    FakeCaptureDriver driver;
+    BusinessLogic::PulseCaptureTask task{driver};
+
+    EXPECT_FALSE(task.start(0U));
+    EXPECT_TRUE(task.start(TICK_HZ));
+    EXPECT_EQ(driver.startedHz, TICK_HZ);
+
+    task.stop();
+    EXPECT_TRUE(driver.stopped);
+}
+
+TEST(PulseCaptureTaskTest, Tick_DrainsFullRingInChunks)
+{
+    FakeCaptureDriver driver;
+    BusinessLogic::PulseCaptureTask task{driver};
+
+    ASSERT_TRUE(task.start(TICK_HZ));
+    driver.push(Driver::CAPTURE_CAPACITY, 10U);
+
+    EXPECT_TRUE(task.tick());
+
+    EXPECT_EQ(driver.readIndex, Driver::CAPTURE_CAPACITY);
+    EXPECT_EQ(task.getHistogram().getCount(), Driver::CAPTURE_CAPACITY - 1U);
+    EXPECT_EQ(task.getHistogram().getBins()[4U], Driver::CAPTURE_CAPACITY - 1U); // 10 in [8, 16)
+}
+
+TEST(PulseCaptureTaskTest, Tick_RestartsIntervalChainAfterLostTicks)
+{
+    FakeCaptureDriver driver;
+    BusinessLogic::PulseCaptureTask task{driver};
+
+    ASSERT_TRUE(task.start(TICK_HZ));
+    driver.push(3U, 2U);
+    EXPECT_TRUE(task.tick());
+
+    driver.lost = 5U;
+    driver.next = static_cast<Driver::CaptureTick>(driver.next + 40'000U);
+    driver.push(3U, 2U);
+
+    EXPECT_FALSE(task.tick());
+    EXPECT_TRUE(task.tick());
+
+    // 2 + 2 intervals of 2 ticks; the one across the lost ticks is not counted.
+    EXPECT_EQ(task.getHistogram().getCount(), 4U);
+    EXPECT_EQ(task.getHistogram().getBins()[2U], 4U);
+}
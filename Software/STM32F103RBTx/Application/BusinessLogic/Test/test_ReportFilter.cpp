@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+import BusinessLogic.ReportFilter;
+import Device;
+
+namespace
+{
+    using BusinessLogic::ReportMode;
+    using BusinessLogic::ReportPolicy;
+    using BusinessLogic::ReportPolicyTable;
+    using Device::MeasurementDeviceId;
+
+    constexpr std::uint32_t HEARTBEAT_TICKS{4U};
+
+    constexpr ReportPolicyTable POLICIES{
+        ReportPolicy{.mode = ReportMode::ON_CHANGE, .deadband = 0U, .heartbeatTicks = 0U},
+        ReportPolicy{.mode = ReportMode::ON_CHANGE, .deadband = 5U, .heartbeatTicks = 0U},
+        ReportPolicy{.mode = ReportMode::ON_CHANGE, .deadband = 0U, .heartbeatTicks = HEARTBEAT_TICKS},
+        ReportPolicy{},
+        ReportPolicy{}};
+
+    auto makeMeasurement(MeasurementDeviceId source, std::uint32_t value) -> Device::MeasurementType
+    {
+        return Device::MeasurementType{.source = source, .data = value};
+    }
+}
+
+TEST(ReportFilterTest, Always_ReportsRepeatedValues)
+{
+    BusinessLogic::ReportFilter filter{POLICIES};
+
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_4, 1U)));
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_4, 1U)));
+    EXPECT_EQ(filter.getSuppressed(MeasurementDeviceId::PULSE_COUNTER_4), 0U);
+}
+
+TEST(ReportFilterTest, OnChange_FirstValueReportedRepeatsSuppressed)
+{
+    BusinessLogic::ReportFilter filter{POLICIES};
+
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_1, 7U)));
+    EXPECT_FALSE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_1, 7U)));
+    EXPECT_FALSE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_1, 7U)));
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_1, 8U)));
+    EXPECT_EQ(filter.getSuppressed(MeasurementDeviceId::PULSE_COUNTER_1), 2U);
+}
+
+TEST(ReportFilterTest, Deadband_ComparesAgainstLastReportedValue)
+{
+    BusinessLogic::ReportFilter filter{POLICIES};
+
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 100U)));
+    EXPECT_FALSE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 105U)));
+    EXPECT_FALSE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 95U)));
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 94U)));
+
+    // Slow drift is reported once it accumulates beyond the deadband.
+    EXPECT_FALSE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 97U)));
+    EXPECT_TRUE(filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_2, 100U)));
+}
+
+TEST(ReportFilterTest, Heartbeat_ReportsUnchangedValuePeriodically)
+{
+    BusinessLogic::ReportFilter filter{POLICIES};
+    std::uint32_t reports = 0U;
+
+    for (std::uint32_t tick = 0U; tick < (HEARTBEAT_TICKS * 3U); ++tick)
+    {
+        filter.advance();
+        reports += filter.shouldReport(makeMeasurement(MeasurementDeviceId::PULSE_COUNTER_3, 0U)) ? 1U : 0U;
+    }
+
+    EXPECT_EQ(reports, 3U);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+import BusinessLogic.RollupAggregator;
+import Device;
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+
+namespace
+{
+    constexpr Driver::CycleTimestamp ONE_SECOND{Driver::coreHz};
+    constexpr Driver::CycleTimestamp ORIGIN{1'000U};
+
+    class RollupRecorder
+    {
+    public:
+        auto writeRollups(std::span<const Device::MeasurementRollup> rollups) noexcept -> bool
+        {
+            written.insert(written.end(), rollups.begin(), rollups.end());
+            ++writes;
+            return accepting;
+        }
+
+        std::vector<Device::MeasurementRollup> written;
+        std::size_t writes{0U};
+        bool accepting{true};
+    };
+
+    auto makeMeasurement(Device::MeasurementDeviceId source, std::uint32_t value, Driver::CycleTimestamp timestamp)
+        -> Device::MeasurementType
+    {
+        return Device::MeasurementType{.source = source, .data = value, .timestamp = timestamp};
+    }
+
+    auto flushAll(BusinessLogic::RollupAggregator<> &aggregator, RollupRecorder &recorder) -> void
+    {
+        std::size_t before{0U};
+
+        do
+        {
+            before = recorder.written.size();
+            EXPECT_TRUE(aggregator.flush(recorder));
+        } while (recorder.written.size() != before);
+    }
+}
+
+TEST(RollupAggregatorTest, SecondWindow_EmitsMinMaxSumCountOnClose)
+{
+    BusinessLogic::RollupAggregator<> aggregator;
+    RollupRecorder recorder;
+
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 5U, ORIGIN));
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 2U, ORIGIN + 100U));
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 9U, ORIGIN + 200U));
+
+    flushAll(aggregator, recorder);
+    EXPECT_EQ(recorder.writes, 0U);
+
+    // The first measurement of the next second closes the window and belongs to the new one.
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 100U, ORIGIN + ONE_SECOND));
+    flushAll(aggregator, recorder);
+
+    ASSERT_EQ(recorder.written.size(), 1U);
+
+    const Device::MeasurementRollup &rollup = recorder.written[0];
+    EXPECT_EQ(rollup.source, Device::MeasurementDeviceId::PULSE_COUNTER_1);
+    EXPECT_EQ(rollup.tier, Device::RollupTier::SECOND);
+    EXPECT_EQ(rollup.count, 3U);
+    EXPECT_EQ(rollup.min, 2U);
+    EXPECT_EQ(rollup.max, 9U);
+    EXPECT_EQ(rollup.sum, 16U);
+    EXPECT_EQ(rollup.start, ORIGIN);
+}
+
+TEST(RollupAggregatorTest, MinuteWindow_MergesTheSecondsOfEverySource)
+{
+    BusinessLogic::RollupAggregator<> aggregator;
+    RollupRecorder recorder;
+
+    for (std::uint32_t second = 0U; second <= 60U; ++second)
+    {
+        const Driver::CycleTimestamp now = ORIGIN + (second * ONE_SECOND);
+
+        aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, second, now));
+        aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::DEVICE_UART_1, 7U, now));
+        flushAll(aggregator, recorder);
+    }
+
+    std::vector<Device::MeasurementRollup> minutes;
+
+    for (const auto &rollup : recorder.written)
+    {
+        if (rollup.tier == Device::RollupTier::MINUTE)
+        {
+            minutes.push_back(rollup);
+        }
+    }
+
+    EXPECT_EQ(recorder.written.size(), (60U * 2U) + 2U);
+    ASSERT_EQ(minutes.size(), 2U);
+
+    EXPECT_EQ(minutes[0].source, Device::MeasurementDeviceId::PULSE_COUNTER_1);
+    EXPECT_EQ(minutes[0].count, 60U);
+    EXPECT_EQ(minutes[0].min, 0U);
+    EXPECT_EQ(minutes[0].max, 59U);
+    EXPECT_EQ(minutes[0].sum, (59U * 60U) / 2U);
+    EXPECT_EQ(minutes[0].start, ORIGIN);
+
+    EXPECT_EQ(minutes[1].source, Device::MeasurementDeviceId::DEVICE_UART_1);
+    EXPECT_EQ(minutes[1].sum, 7U * 60U);
+}
+
+TEST(RollupAggregatorTest, Gap_SkipsEmptyWindowsAndStaysAligned)
+{
+    BusinessLogic::RollupAggregator<> aggregator;
+    RollupRecorder recorder;
+
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_2, 1U, ORIGIN));
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_2, 1U, ORIGIN + (5U * ONE_SECOND) + 10U));
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_2, 1U, ORIGIN + (6U * ONE_SECOND)));
+    flushAll(aggregator, recorder);
+
+    ASSERT_EQ(recorder.written.size(), 2U);
+    EXPECT_EQ(recorder.written[0].start, ORIGIN);
+    EXPECT_EQ(recorder.written[1].start, ORIGIN + (5U * ONE_SECOND));
+}
+
+TEST(RollupAggregatorTest, Flush_HandsOverAtMostOneBatchPerCall)
+{
+    BusinessLogic::RollupAggregator<> aggregator;
+    RollupRecorder recorder;
+
+    for (std::uint32_t second = 0U; second < 3U; ++second)
+    {
+        for (std::uint8_t source = 0U; source < BusinessLogic::MEASUREMENT_SOURCE_COUNT; ++source)
+        {
+            aggregator.observe(makeMeasurement(static_cast<Device::MeasurementDeviceId>(source),
+                                               1U,
+                                               ORIGIN + (second * ONE_SECOND)));
+        }
+    }
+
+    EXPECT_TRUE(aggregator.flush(recorder));
+    EXPECT_EQ(recorder.written.size(), BusinessLogic::RollupAggregator<>::FLUSH_BATCH);
+
+    EXPECT_TRUE(aggregator.flush(recorder));
+    EXPECT_EQ(recorder.written.size(), 2U * BusinessLogic::MEASUREMENT_SOURCE_COUNT);
+    EXPECT_EQ(aggregator.getDropped(), 0U);
+}
+
+TEST(RollupAggregatorTest, Flush_RetriesRollupsTheRecorderDidNotAccept)
+{
+    BusinessLogic::RollupAggregator<> aggregator;
+    RollupRecorder recorder;
+
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 4U, ORIGIN));
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 6U, ORIGIN + ONE_SECOND));
+
+    recorder.accepting = false;
+    EXPECT_FALSE(aggregator.flush(recorder));
+    EXPECT_EQ(aggregator.getFailedFlushes(), 1U);
+
+    aggregator.observe(makeMeasurement(Device::MeasurementDeviceId::PULSE_COUNTER_1, 8U, ORIGIN + (2U * ONE_SECOND)));
+
+    recorder.accepting = true;
+    recorder.written.clear();
+    EXPECT_TRUE(aggregator.flush(recorder));
+
+    // The rejected rollup is handed over again, ahead of the one closed since.
+    ASSERT_EQ(recorder.written.size(), 2U);
+    EXPECT_EQ(recorder.written[0].sum, 4U);
+    EXPECT_EQ(recorder.written[1].sum, 6U);
+    EXPECT_EQ(aggregator.getFailedFlushes(), 1U);
+}
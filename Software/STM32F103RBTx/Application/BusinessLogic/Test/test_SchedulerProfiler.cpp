@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+import BusinessLogic.SchedulerProfiler;
+import BusinessLogic.TaskId;
+
+namespace
+{
+    constexpr std::size_t SLOTS_PER_CYCLE{4U};
+
+    using Profiler = BusinessLogic::CycleProfiler<SLOTS_PER_CYCLE>;
+}
+
+// ==================== CycleStats Tests ====================
+
+TEST(CycleStatsTest, Empty_ReportsZero)
+{
+    const BusinessLogic::CycleStats stats{};
+
+    EXPECT_EQ(stats.count, 0U);
+    EXPECT_EQ(stats.mean(), 0U);
+    EXPECT_EQ(stats.percentile(99U), 0U);
+}
+
+TEST(CycleStatsTest, Record_TracksMinMaxMean)
+{
+    BusinessLogic::CycleStats stats{};
+
+    stats.record(100U);
+    stats.record(300U);
+    stats.record(200U);
+
+    EXPECT_EQ(stats.count, 3U);
+    EXPECT_EQ(stats.min, 100U);
+    EXPECT_EQ(stats.max, 300U);
+    EXPECT_EQ(stats.mean(), 200U);
+}
+
+TEST(CycleStatsTest, Record_FillsLog2Buckets)
+{
+    BusinessLogic::CycleStats stats{};
+
+    stats.record(0U);
+    stats.record(1U);
+    stats.record(3U);
+    stats.record(4U);
+    stats.record(7U);
+
+    EXPECT_EQ(stats.histogram[0], 1U);
+    EXPECT_EQ(stats.histogram[1], 1U);
+    EXPECT_EQ(stats.histogram[2], 1U);
+    EXPECT_EQ(stats.histogram[3], 2U);
+}
+
+TEST(CycleStatsTest, Percentile_ReturnsBucketUpperBound)
+{
+    BusinessLogic::CycleStats stats{};
+
+    for (std::uint32_t i = 0U; i < 99U; ++i)
+    {
+        stats.record(1'000U); // bucket 10: [512, 1023]
+    }
+
+    stats.record(50'000U); // bucket 16: [32768, 65535]
+
+    EXPECT_EQ(stats.percentile(50U), 1'023U);
+    EXPECT_EQ(stats.percentile(99U), 1'023U);
+    EXPECT_EQ(stats.percentile(100U), 50'000U); // clamped to observed max
+}
+
+// ==================== CycleProfiler Tests ====================
+
+TEST(CycleProfilerTest, RecordTaskAndSlot_UpdatesMatchingEntries)
+{
+    Profiler profiler{};
+
+    profiler.recordTask(BusinessLogic::TaskId::KEYBOARD, 40U);
+    profiler.recordSlot(2U, 90U);
+
+    const auto &snapshot = profiler.snapshot();
+
+    EXPECT_EQ(snapshot.tasks[0].count, 0U);
+    EXPECT_EQ(snapshot.tasks[1].count, 1U);
+    EXPECT_EQ(snapshot.tasks[1].max, 40U);
+    EXPECT_EQ(snapshot.slots[2].count, 1U);
+    EXPECT_EQ(snapshot.slots[2].max, 90U);
+}
+
+TEST(CycleProfilerTest, RecordSlot_OutOfRangeIsIgnored)
+{
+    Profiler profiler{};
+
+    profiler.recordSlot(SLOTS_PER_CYCLE, 10U);
+
+    for (const auto &slot : profiler.snapshot().slots)
+    {
+        EXPECT_EQ(slot.count, 0U);
+    }
+}
+
+TEST(CycleProfilerTest, Reset_ClearsStatistics)
+{
+    Profiler profiler{};
+
+    profiler.recordTask(BusinessLogic::TaskId::MEASUREMENT, 10U);
+    profiler.reset();
+
+    EXPECT_EQ(profiler.snapshot().tasks[0].count, 0U);
+}
+
+// ==================== SchedulerProfileReport Tests ====================
+
+TEST(SchedulerProfileReportTest, FormatLine_WritesCsv)
+{
+    BusinessLogic::CycleStats stats{};
+    stats.record(10U);
+    stats.record(30U);
+
+    std::array<char, BusinessLogic::SchedulerProfileReport::LINE_BUFFER_SIZE> buffer{};
+
+    const std::size_t length =
+        BusinessLogic::SchedulerProfileReport::formatLine("task", 1U, stats, std::span{buffer});
+
+    EXPECT_EQ(std::string_view(buffer.data(), length), "task,1,2,10,20,30,30\n");
+}
+
+TEST(SchedulerProfileReportTest, FormatLine_EmptyStatsReportsZeroMin)
+{
+    const BusinessLogic::CycleStats stats{};
+
+    std::array<char, BusinessLogic::SchedulerProfileReport::LINE_BUFFER_SIZE> buffer{};
+
+    const std::size_t length =
+        BusinessLogic::SchedulerProfileReport::formatLine("slot", 0U, stats, std::span{buffer});
+
+    EXPECT_EQ(std::string_view(buffer.data(), length), "slot,0,0,0,0,0,0\n");
+}
+
+TEST(SchedulerProfileReportTest, FormatLine_BufferTooSmall_ReturnsZero)
+{
+    BusinessLogic::CycleStats stats{};
+    stats.record(123'456U);
+
+    std::array<char, 8U> buffer{};
+
+    const std::size_t length =
+        BusinessLogic::SchedulerProfileReport::formatLine("task", 0U, stats, std::span{buffer});
+
+    EXPECT_EQ(length, 0U);
+}
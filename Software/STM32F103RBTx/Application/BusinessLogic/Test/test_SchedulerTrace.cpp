@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+import BusinessLogic.SchedulerTrace;
+import BusinessLogic.TraceFormat;
+
+namespace
+{
+    using BusinessLogic::TraceBlockHeader;
+    using BusinessLogic::TraceEventType;
+    using BusinessLogic::TraceRecord;
+    using BusinessLogic::TraceWire;
+
+    using Ring = BusinessLogic::TraceRing<4U>;
+
+    auto makeRecord(std::uint32_t timestamp, TraceEventType type = TraceEventType::SLOT_START) -> TraceRecord
+    {
+        return TraceRecord{.timestamp = timestamp, .type = type, .id = 1U, .arg = 2U};
+    }
+}
+
+// ==================== Ring Tests ====================
+
+TEST(TraceRingTest, Pop_Empty_ReturnsFalse)
+{
+    Ring ring;
+    TraceRecord record{};
+
+    EXPECT_FALSE(ring.pop(record));
+    EXPECT_EQ(ring.size(), 0U);
+}
+
+TEST(TraceRingTest, PushPop_KeepsOrder)
+{
+    Ring ring;
+
+    EXPECT_TRUE(ring.push(makeRecord(10U)));
+    EXPECT_TRUE(ring.push(makeRecord(20U)));
+    EXPECT_EQ(ring.size(), 2U);
+
+    TraceRecord record{};
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(record.timestamp, 10U);
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(record.timestamp, 20U);
+    EXPECT_FALSE(ring.pop(record));
+}
+
+TEST(TraceRingTest, Push_Full_DropsNewestAndCounts)
+{
+    Ring ring;
+
+    for (std::uint32_t i = 0U; i < Ring::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(ring.push(makeRecord(i)));
+    }
+
+    EXPECT_FALSE(ring.push(makeRecord(99U)));
+    EXPECT_FALSE(ring.push(makeRecord(100U)));
+    EXPECT_EQ(ring.getDropped(), 2U);
+    EXPECT_EQ(ring.takeDropped(), 2U);
+    EXPECT_EQ(ring.getDropped(), 0U);
+
+    TraceRecord record{};
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(record.timestamp, 0U); // oldest kept
+}
+
+TEST(TraceRingTest, PushPop_WrapsAroundCapacity)
+{
+    Ring ring;
+    TraceRecord record{};
+
+    for (std::uint32_t i = 0U; i < (Ring::CAPACITY * 3U); ++i)
+    {
+        ASSERT_TRUE(ring.push(makeRecord(i)));
+        ASSERT_TRUE(ring.pop(record));
+        EXPECT_EQ(record.timestamp, i);
+    }
+}
+
+// ==================== Wire Format Tests ====================
+
+TEST(TraceWireTest, Header_RoundTrip)
+{
+    std::array<std::uint8_t, TraceWire::HEADER_SIZE> buffer{};
+    const TraceBlockHeader header{.recordCount = 3U, .droppedRecords = 0x01020304U, .cycleHz = 72'000'000U};
+
+    ASSERT_EQ(TraceWire::encodeHeader(header, buffer), TraceWire::HEADER_SIZE);
+    EXPECT_EQ(buffer[0], 'H');
+    EXPECT_EQ(buffer[8], 0x04U); // little-endian
+
+    TraceBlockHeader decoded{};
+    ASSERT_TRUE(TraceWire::decodeHeader(buffer, decoded));
+    EXPECT_EQ(decoded.recordCount, 3U);
+    EXPECT_EQ(decoded.droppedRecords, 0x01020304U);
+    EXPECT_EQ(decoded.cycleHz, 72'000'000U);
+}
+
+TEST(TraceWireTest, Record_RoundTrip)
+{
+    std::array<std::uint8_t, TraceWire::RECORD_SIZE> buffer{};
+    const TraceRecord record{.timestamp = 0xAABBCCDDU, .type = TraceEventType::TASK_END, .id = 1U, .arg = 0x1234U};
+
+    ASSERT_EQ(TraceWire::encodeRecord(record, buffer), TraceWire::RECORD_SIZE);
+
+    const TraceRecord decoded = TraceWire::decodeRecord(buffer);
+    EXPECT_EQ(decoded.timestamp, record.timestamp);
+    EXPECT_EQ(decoded.type, record.type);
+    EXPECT_EQ(decoded.id, record.id);
+    EXPECT_EQ(decoded.arg, record.arg);
+}
+
+TEST(TraceWireTest, DecodeHeader_BadMagic_Rejected)
+{
+    std::array<std::uint8_t, TraceWire::HEADER_SIZE> buffer{};
+    ASSERT_EQ(TraceWire::encodeHeader(TraceBlockHeader{}, buffer), TraceWire::HEADER_SIZE);
+    buffer[1] = 'X';
+
+    TraceBlockHeader decoded{};
+    EXPECT_FALSE(TraceWire::decodeHeader(buffer, decoded));
+}
+
+TEST(TraceWireTest, Encode_BufferTooSmall_ReturnsZero)
+{
+    std::array<std::uint8_t, TraceWire::HEADER_SIZE - 1U> small{};
+
+    EXPECT_EQ(TraceWire::encodeHeader(TraceBlockHeader{}, small), 0U);
+    EXPECT_EQ(TraceWire::encodeRecord(TraceRecord{}, std::span{small}.first(TraceWire::RECORD_SIZE - 1U)), 0U);
+}
+
+// ==================== Global Trace Tests ====================
+
+TEST(SchedulerTraceTest, ReadBlock_DrainsRecordedEvents)
+{
+    if constexpr (!BusinessLogic::TRACE_ENABLED)
+    {
+        GTEST_SKIP() << "Built without HDL_SCHEDULER_TRACE";
+    }
+
+    std::array<std::uint8_t, BusinessLogic::SchedulerTrace::BLOCK_SIZE> block{};
+
+    // Start from an empty ring.
+    while (BusinessLogic::SchedulerTrace::readBlock(block) != 0U)
+    {
+    }
+
+    BusinessLogic::SchedulerTrace::record(TraceEventType::TASK_START, 0U);
+    BusinessLogic::SchedulerTrace::record(TraceEventType::TASK_END, 0U, 1U);
+
+    const std::size_t length = BusinessLogic::SchedulerTrace::readBlock(block);
+    ASSERT_EQ(length, TraceWire::HEADER_SIZE + (2U * TraceWire::RECORD_SIZE));
+
+    TraceBlockHeader header{};
+    ASSERT_TRUE(TraceWire::decodeHeader(block, header));
+    EXPECT_EQ(header.recordCount, 2U);
+    EXPECT_EQ(header.droppedRecords, 0U);
+
+    const TraceRecord end = TraceWire::decodeRecord(std::span{block}.subspan(TraceWire::HEADER_SIZE + TraceWire::RECORD_SIZE));
+    EXPECT_EQ(end.type, TraceEventType::TASK_END);
+    EXPECT_EQ(end.arg, 1U);
+
+    EXPECT_EQ(BusinessLogic::SchedulerTrace::readBlock(block), 0U);
+}
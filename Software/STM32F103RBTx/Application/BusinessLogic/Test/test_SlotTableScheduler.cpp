@@ -0,0 +1,676 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+import BusinessLogic.BackgroundJob;
+import BusinessLogic.SchedulerTrace;
+import BusinessLogic.SlotTableScheduler;
+import BusinessLogic.TaskId;
+import BusinessLogic.TickDelegate;
+import BusinessLogic.TraceFormat;
+
+import Device.CoTask;
+
+import Driver.CycleClock;
+import Driver.CycleCpu;
+import Driver.IsrEvent;
+
+namespace
+{
+    class CountingTask
+    {
+    public:
+        auto tick() noexcept -> bool
+        {
+            ++calls;
+            Driver::CycleClock::advance(cost);
+            return result;
+        }
+
+        std::uint32_t calls{0U};
+        bool result{true};
+        Driver::CycleCpu cost{0U}; // simulated execution time on the virtual clock
+    };
+
+    class SlicedJob
+    {
+    public:
+        auto runSlice(Driver::CycleCpu budgetCycles) noexcept -> BusinessLogic::JobState
+        {
+            ++calls;
+            lastBudget = budgetCycles;
+            Driver::CycleClock::advance(cost);
+
+            BusinessLogic::JobState state = BusinessLogic::JobState::MORE_WORK;
+
+            if (calls >= slices)
+            {
+                state = failOnLast ? BusinessLogic::JobState::FAILED : BusinessLogic::JobState::DONE;
+            }
+
+            return state;
+        }
+
+        std::uint32_t calls{0U};
+        std::uint32_t slices{1U};
+        bool failOnLast{false};
+        Driver::CycleCpu cost{0U};
+        Driver::CycleCpu lastBudget{0U};
+    };
+
+    auto transmitFrames(std::atomic<bool> &txComplete, std::uint32_t &frames) -> Device::CoTask
+    {
+        for (std::uint32_t i = 0U; i < 2U; ++i)
+        {
+            txComplete.store(false); // start of the simulated DMA transfer
+            ++frames;
+            co_await Device::untilSet(txComplete);
+        }
+
+        co_return true;
+    }
+
+    using Scheduler = BusinessLogic::SlotTableScheduler<4U, 2U>;
+    using BusinessLogic::TaskId;
+
+    constexpr Driver::CycleCpu SLOT_BUDGET{1'000U};
+
+    constexpr Scheduler::SlotTable SLOT_TABLE{{
+        Scheduler::Slot{.taskIds{TaskId::MEASUREMENT, TaskId::KEYBOARD}, .taskIdCount = 2U, .budgetCycles = SLOT_BUDGET},
+        Scheduler::Slot{.taskIds{TaskId::MEASUREMENT}, .taskIdCount = 1U, .budgetCycles = SLOT_BUDGET},
+        Scheduler::Slot{.taskIds{TaskId::MEASUREMENT, TaskId::KEYBOARD}, .taskIdCount = 2U, .budgetCycles = SLOT_BUDGET},
+        Scheduler::Slot{.taskIds{TaskId::MEASUREMENT}, .taskIdCount = 1U, .budgetCycles = SLOT_BUDGET},
+    }};
+
+    constexpr std::uint32_t MAX_CATCH_UP{2U};
+    constexpr std::uint32_t MAX_SHED_CATCH_UP{8U};
+}
+
+class SlotTableSchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Driver::CycleClock::setSource(Driver::CycleClockSource::VIRTUAL);
+        Driver::CycleClock::init();
+    }
+
+    void TearDown() override
+    {
+        Driver::CycleClock::setSource(Driver::CycleClockSource::MONOTONIC_RAW);
+    }
+
+    auto notify(std::uint32_t slots) -> void
+    {
+        for (std::uint32_t i = 0U; i < slots; ++i)
+        {
+            scheduler.notifyTimeSlotIsr();
+        }
+    }
+
+    CountingTask measurement;
+    CountingTask keyboard;
+    CountingTask recorder; // bound to the recorder and capture task ids, not in SLOT_TABLE
+
+    Scheduler::TaskCallTable taskCallTable{BusinessLogic::TickDelegate(measurement),
+                                           BusinessLogic::TickDelegate(keyboard),
+                                           BusinessLogic::TickDelegate(recorder),
+                                           BusinessLogic::TickDelegate(recorder),
+                                           BusinessLogic::TickDelegate(recorder)};
+
+    Scheduler scheduler{Scheduler::Config{SLOT_TABLE, taskCallTable, MAX_CATCH_UP, MAX_SHED_CATCH_UP}};
+};
+
+// ==================== Lifecycle Tests ====================
+
+TEST_F(SlotTableSchedulerTest, RunPending_BeforeStart_ReturnsFalse)
+{
+    notify(1U);
+
+    EXPECT_FALSE(scheduler.runPending());
+    EXPECT_EQ(scheduler.getStatus().error, BusinessLogic::Error::NOT_STARTED);
+    EXPECT_EQ(measurement.calls, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_NoPendingSlots_RunsNothing)
+{
+    ASSERT_TRUE(scheduler.start());
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, 0U);
+    EXPECT_EQ(keyboard.calls, 0U);
+}
+
+// ==================== Real-Time Tests ====================
+
+TEST_F(SlotTableSchedulerTest, RunPending_OneSlot_RunsSlotTasksAndConsumesBacklog)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, 1U);
+    EXPECT_EQ(keyboard.calls, 1U);
+    EXPECT_EQ(scheduler.getStatus().backlogAfterRun, 0U);
+
+    // Nothing new pending, nothing runs again.
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, 1U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_BacklogWithinLimit_RunsAllTasks)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(MAX_CATCH_UP);
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, 2U);
+    EXPECT_EQ(keyboard.calls, 1U);
+    EXPECT_FALSE(scheduler.getStatus().loadShedding);
+    EXPECT_EQ(scheduler.getStatus().shedSlots, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_TaskFails_LatchesTaskFailed)
+{
+    ASSERT_TRUE(scheduler.start());
+    keyboard.result = false;
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_TRUE(scheduler.getStatus().taskFailed);
+    EXPECT_EQ(scheduler.getStatus().error, BusinessLogic::Error::TASK_FAILED_LATCHED);
+}
+
+// ==================== Load Shedding Tests ====================
+
+TEST_F(SlotTableSchedulerTest, RunPending_Backlog_ShedsLoadAndKeepsMeasurementCadence)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(6U); // slots 0,1,2,3,0,1 -> KEYBOARD scheduled three times
+
+    EXPECT_FALSE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_TRUE(status.schedulerLag);
+    EXPECT_TRUE(status.loadShedding);
+    EXPECT_EQ(status.error, BusinessLogic::Error::SCHEDULER_LAG_LATCHED);
+    EXPECT_EQ(measurement.calls, 6U);
+    EXPECT_EQ(keyboard.calls, 1U);
+    EXPECT_EQ(status.shedSlots, 6U);
+    EXPECT_EQ(status.coalescedTasks, 2U);
+    EXPECT_EQ(status.shedTasks, 0U);
+    EXPECT_EQ(status.backlogAfterRun, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_LargeBacklog_LimitedByShedCatchUp)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(MAX_SHED_CATCH_UP + 3U);
+
+    EXPECT_FALSE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, MAX_SHED_CATCH_UP);
+    EXPECT_EQ(scheduler.getStatus().backlogAfterRun, 3U);
+
+    // Remaining backlog is above the normal limit: still shedding.
+    EXPECT_FALSE(scheduler.runPending());
+    EXPECT_EQ(measurement.calls, MAX_SHED_CATCH_UP + 3U);
+    EXPECT_EQ(scheduler.getStatus().backlogAfterRun, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_AfterRecovery_LeavesLoadShedding)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(5U);
+    EXPECT_FALSE(scheduler.runPending());
+
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_FALSE(scheduler.getStatus().loadShedding);
+    EXPECT_TRUE(scheduler.getStatus().schedulerLag); // latched until cleared
+
+    scheduler.clearStatus();
+    EXPECT_FALSE(scheduler.getStatus().schedulerLag);
+    EXPECT_EQ(scheduler.getStatus().shedSlots, 0U);
+}
+
+// ==================== Timing Tests ====================
+
+TEST_F(SlotTableSchedulerTest, RunPending_WithinBudget_NoOverrun)
+{
+    ASSERT_TRUE(scheduler.start());
+    measurement.cost = 400U;
+    keyboard.cost = 400U;
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_FALSE(status.slotOverrun);
+    EXPECT_EQ(Driver::CycleClock::elapsed(status.lastStart, status.lastEnd), 800U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_OverBudget_LatchesSlotOverrun)
+{
+    ASSERT_TRUE(scheduler.start());
+    measurement.cost = 600U;
+    keyboard.cost = 600U;
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_TRUE(status.slotOverrun);
+    EXPECT_EQ(status.error, BusinessLogic::Error::SLOT_OVERRUN_LATCHED);
+    EXPECT_EQ(Driver::CycleClock::elapsed(status.lastStart, status.lastEnd), 1'200U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_MonotonicClock_MeasuresHostTime)
+{
+    Driver::CycleClock::setSource(Driver::CycleClockSource::MONOTONIC_RAW);
+    ASSERT_TRUE(scheduler.start());
+    notify(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_GE(status.lastEnd, status.lastStart);
+}
+
+// ==================== Dispatch Latency Tests ====================
+
+TEST_F(SlotTableSchedulerTest, RunPending_MeasuresIsrToSlotLatency)
+{
+    ASSERT_TRUE(scheduler.start());
+
+    notify(1U);
+    Driver::CycleClock::advance(100U); // wakeup and main loop delay
+    EXPECT_TRUE(scheduler.runPending());
+
+    notify(1U);
+    Driver::CycleClock::advance(250U);
+    EXPECT_TRUE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_EQ(status.dispatchLatency.count, 2U);
+    EXPECT_EQ(status.dispatchLatency.min, 100U);
+    EXPECT_EQ(status.dispatchLatency.max, 250U);
+    EXPECT_EQ(status.lastDispatchLatency, 250U);
+    EXPECT_EQ(status.dispatchJitterMax, 150U);
+    EXPECT_EQ(status.dispatchLatencyUnmeasured, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_CatchUp_LatencyIncludesEarlierSlots)
+{
+    ASSERT_TRUE(scheduler.start());
+    measurement.cost = 300U;
+    keyboard.cost = 200U;
+
+    notify(MAX_CATCH_UP);
+    Driver::CycleClock::advance(50U);
+    EXPECT_TRUE(scheduler.runPending());
+
+    // The last tick released slot 1, which started after slot 0 (500 cycles) had run.
+    const auto &status = scheduler.getStatus();
+    EXPECT_EQ(status.dispatchLatency.count, 1U);
+    EXPECT_EQ(status.lastDispatchLatency, 550U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_BacklogRemains_NotSampled)
+{
+    ASSERT_TRUE(scheduler.start());
+    notify(MAX_SHED_CATCH_UP + 1U);
+
+    EXPECT_FALSE(scheduler.runPending());
+
+    const auto &status = scheduler.getStatus();
+    EXPECT_EQ(status.dispatchLatency.count, 0U);
+    EXPECT_EQ(status.dispatchLatencyUnmeasured, 1U);
+
+    scheduler.clearStatus();
+    EXPECT_EQ(scheduler.getStatus().dispatchLatencyUnmeasured, 0U);
+}
+
+// ==================== Event Trigger Tests ====================
+
+class SlotTableSchedulerEventTest : public SlotTableSchedulerTest
+{
+protected:
+    static constexpr Scheduler::TaskTriggerTable TRIGGERS{
+        Scheduler::eventMask(Driver::IsrEvent::PULSE_COUNTER_EDGE) |
+            Scheduler::eventMask(Driver::IsrEvent::MEASUREMENT_UART_IDLE),
+        0U};
+
+    Scheduler eventScheduler{
+        Scheduler::Config{SLOT_TABLE, taskCallTable, MAX_CATCH_UP, MAX_SHED_CATCH_UP, TRIGGERS}};
+};
+
+TEST_F(SlotTableSchedulerEventTest, RunPending_NoEvent_SkipsTriggeredTask)
+{
+    ASSERT_TRUE(eventScheduler.start());
+    eventScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(eventScheduler.runPending());
+    EXPECT_EQ(measurement.calls, 0U);
+    EXPECT_EQ(keyboard.calls, 1U); // periodic task unaffected
+    EXPECT_EQ(eventScheduler.getStatus().eventSkippedTasks, 1U);
+}
+
+TEST_F(SlotTableSchedulerEventTest, RunPending_EventPending_RunsOnceAndConsumesEvent)
+{
+    ASSERT_TRUE(eventScheduler.start());
+    eventScheduler.notifyEventIsr(Driver::IsrEvent::PULSE_COUNTER_EDGE);
+    eventScheduler.notifyTimeSlotIsr();
+    eventScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(eventScheduler.runPending());
+    EXPECT_EQ(measurement.calls, 1U);
+    EXPECT_EQ(eventScheduler.getPendingEvents(), 0U);
+    EXPECT_EQ(eventScheduler.getStatus().eventSkippedTasks, 1U);
+}
+
+TEST_F(SlotTableSchedulerEventTest, RunPending_UnrelatedEvent_StaysPending)
+{
+    ASSERT_TRUE(eventScheduler.start());
+    eventScheduler.notifyEventIsr(Driver::IsrEvent::LIGHT_SENSOR_DMA_COMPLETE);
+    eventScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(eventScheduler.runPending());
+    EXPECT_EQ(measurement.calls, 0U);
+    EXPECT_EQ(eventScheduler.getPendingEvents(),
+              Scheduler::eventMask(Driver::IsrEvent::LIGHT_SENSOR_DMA_COMPLETE));
+}
+
+TEST_F(SlotTableSchedulerEventTest, NotifyEventIsr_TracesOnlyWhenEventBecomesPending)
+{
+    if constexpr (!BusinessLogic::TRACE_ENABLED)
+    {
+        GTEST_SKIP() << "Built without HDL_SCHEDULER_TRACE";
+    }
+
+    ASSERT_TRUE(eventScheduler.start());
+
+    std::array<std::uint8_t, BusinessLogic::SchedulerTrace::BLOCK_SIZE> block{};
+
+    while (BusinessLogic::SchedulerTrace::readBlock(block) != 0U)
+    {
+    }
+
+    eventScheduler.notifyEventIsr(Driver::IsrEvent::PULSE_COUNTER_EDGE);
+    eventScheduler.notifyEventIsr(Driver::IsrEvent::PULSE_COUNTER_EDGE);
+    eventScheduler.notifyEventIsr(Driver::IsrEvent::PULSE_COUNTER_EDGE);
+
+    BusinessLogic::TraceBlockHeader header{};
+    ASSERT_NE(BusinessLogic::SchedulerTrace::readBlock(block), 0U);
+    ASSERT_TRUE(BusinessLogic::TraceWire::decodeHeader(block, header));
+    EXPECT_EQ(header.recordCount, 1U);
+}
+
+// ==================== Tickless Idle Tests ====================
+
+class SlotTableSchedulerTicklessTest : public SlotTableSchedulerTest
+{
+protected:
+    // Work only in slots 0 and 3.
+    static constexpr Scheduler::SlotTable SPARSE_TABLE{{
+        Scheduler::Slot{.taskIds{TaskId::MEASUREMENT}, .taskIdCount = 1U, .budgetCycles = SLOT_BUDGET},
+        Scheduler::Slot{},
+        Scheduler::Slot{},
+        Scheduler::Slot{.taskIds{TaskId::KEYBOARD}, .taskIdCount = 1U, .budgetCycles = SLOT_BUDGET},
+    }};
+
+    static constexpr std::uint32_t MAX_IDLE_SLOTS{16U};
+
+    Scheduler sparseScheduler{Scheduler::Config{SPARSE_TABLE, taskCallTable, MAX_CATCH_UP, MAX_SHED_CATCH_UP}};
+};
+
+TEST_F(SlotTableSchedulerTicklessTest, IdleSlotsUntilWork_BeforeStart_ReturnsOne)
+{
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS), 1U);
+}
+
+TEST_F(SlotTableSchedulerTicklessTest, IdleSlotsUntilWork_SleepsThroughEmptySlots)
+{
+    ASSERT_TRUE(sparseScheduler.start());
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS), 1U); // slot 0 has work
+
+    sparseScheduler.notifyTimeSlotIsr();
+    ASSERT_TRUE(sparseScheduler.runPending());
+
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS), 3U); // slots 1, 2 empty
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(2U), 2U);             // limited by the timer
+}
+
+TEST_F(SlotTableSchedulerTicklessTest, IdleSlotsUntilWork_PendingSlots_ReturnsOne)
+{
+    ASSERT_TRUE(sparseScheduler.start());
+    sparseScheduler.notifyTimeSlotIsr();
+    ASSERT_TRUE(sparseScheduler.runPending());
+    sparseScheduler.notifyTimeSlotIsr();
+
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS), 1U);
+}
+
+TEST_F(SlotTableSchedulerTicklessTest, NotifyTimeSlotsElapsed_ResyncsSlotIndex)
+{
+    ASSERT_TRUE(sparseScheduler.start());
+    sparseScheduler.notifyTimeSlotIsr();
+    ASSERT_TRUE(sparseScheduler.runPending());
+
+    const std::uint32_t idle = sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS);
+    sparseScheduler.notifyTimeSlotsElapsedIsr(idle);
+
+    EXPECT_TRUE(sparseScheduler.runPending());
+
+    const auto &status = sparseScheduler.getStatus();
+    EXPECT_EQ(status.lastSlot, 3U);
+    EXPECT_EQ(status.idleSkippedSlots, 2U);
+    EXPECT_EQ(status.backlogAfterRun, 0U);
+    EXPECT_FALSE(status.schedulerLag);
+    EXPECT_EQ(measurement.calls, 1U);
+    EXPECT_EQ(keyboard.calls, 1U);
+
+    // Periods are unchanged: the next slot is slot 0 again.
+    EXPECT_EQ(sparseScheduler.idleSlotsUntilWork(MAX_IDLE_SLOTS), 1U);
+}
+
+TEST_F(SlotTableSchedulerTicklessTest, NotifyTimeSlotsElapsed_OneSlot_MatchesPeriodicTick)
+{
+    ASSERT_TRUE(scheduler.start());
+    scheduler.notifyTimeSlotsElapsedIsr(1U);
+
+    EXPECT_TRUE(scheduler.runPending());
+    EXPECT_EQ(scheduler.getStatus().lastSlot, 0U);
+    EXPECT_EQ(scheduler.getStatus().idleSkippedSlots, 0U);
+    EXPECT_EQ(measurement.calls, 1U);
+}
+
+// ==================== Background Job Tests ====================
+
+class SlotTableSchedulerBackgroundTest : public SlotTableSchedulerTest
+{
+protected:
+    static constexpr Driver::CycleCpu WINDOW{2'000U};
+
+    Scheduler jobScheduler{Scheduler::Config{.slotTable = SLOT_TABLE,
+                                             .taskCallTable = taskCallTable,
+                                             .maxCatchUpPerCall = MAX_CATCH_UP,
+                                             .maxShedCatchUpPerCall = MAX_SHED_CATCH_UP,
+                                             .backgroundWindowCycles = WINDOW}};
+
+    SlicedJob first;
+    SlicedJob second;
+};
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_RunsJobInSlotSlack)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    measurement.cost = 300U;
+    keyboard.cost = 200U;
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+    jobScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(jobScheduler.runPending());
+
+    const auto &status = jobScheduler.getStatus();
+    EXPECT_EQ(first.calls, 1U);
+    EXPECT_EQ(first.lastBudget, WINDOW - 500U);
+    EXPECT_EQ(status.backgroundJobsCompleted, 1U);
+    EXPECT_EQ(status.backgroundQueueDepth, 0U);
+    EXPECT_EQ(status.backgroundQueueHighWater, 1U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_MultiSliceJob_ResumesInLaterSlots)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    first.slices = 3U;
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+
+    for (std::uint32_t slot = 0U; slot < 3U; ++slot)
+    {
+        jobScheduler.notifyTimeSlotIsr();
+        EXPECT_TRUE(jobScheduler.runPending());
+        EXPECT_EQ(first.calls, slot + 1U); // one slice per run
+    }
+
+    EXPECT_EQ(jobScheduler.getStatus().backgroundJobsCompleted, 1U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueDepth, 0U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_WindowUsedUp_StopsSlicing)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    first.cost = WINDOW;
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(second)));
+    jobScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(first.calls, 1U);
+    EXPECT_EQ(second.calls, 0U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueDepth, 1U);
+
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(second.calls, 1U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_SlotTasksUseWindow_ReportsStarvation)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    measurement.cost = WINDOW;
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+
+    const auto &status = jobScheduler.getStatus();
+    EXPECT_EQ(first.calls, 0U);
+    EXPECT_EQ(status.backgroundStarvedRuns, 2U);
+    EXPECT_EQ(status.backgroundMaxStarvedRuns, 2U);
+    EXPECT_EQ(status.backgroundQueueDepth, 1U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_Backlog_DefersJobs)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+
+    for (std::uint32_t i = 0U; i < (MAX_SHED_CATCH_UP + 1U); ++i)
+    {
+        jobScheduler.notifyTimeSlotIsr();
+    }
+
+    EXPECT_FALSE(jobScheduler.runPending());
+    EXPECT_EQ(jobScheduler.getStatus().backlogAfterRun, 1U);
+    EXPECT_EQ(first.calls, 0U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundStarvedRuns, 1U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_FailedJob_CountedAndRemoved)
+{
+    ASSERT_TRUE(jobScheduler.start());
+    first.failOnLast = true;
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(first)));
+    jobScheduler.notifyTimeSlotIsr();
+
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(jobScheduler.getStatus().backgroundJobsFailed, 1U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueDepth, 0U);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, SubmitJob_QueueFull_Rejected)
+{
+    std::array<SlicedJob, Scheduler::BACKGROUND_JOB_CAPACITY + 1U> jobs{};
+
+    for (std::size_t i = 0U; i < Scheduler::BACKGROUND_JOB_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(jobs[i])));
+    }
+
+    EXPECT_FALSE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(jobs.back())));
+    EXPECT_EQ(jobScheduler.getStatus().backgroundJobsRejected, 1U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueHighWater, Scheduler::BACKGROUND_JOB_CAPACITY);
+}
+
+TEST_F(SlotTableSchedulerBackgroundTest, RunPending_CoTaskJob_ResumedEachSlotUntilDone)
+{
+    std::atomic<bool> txComplete{false};
+    std::uint32_t frames = 0U;
+    Device::CoTask batch = transmitFrames(txComplete, frames);
+    BusinessLogic::CoTaskJob job{batch};
+
+    ASSERT_TRUE(jobScheduler.start());
+    ASSERT_TRUE(jobScheduler.submitJob(BusinessLogic::BackgroundJob(job)));
+
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(frames, 1U);
+
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(frames, 1U); // waiting for the DMA flag
+
+    txComplete.store(true);
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_EQ(frames, 2U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueDepth, 1U);
+
+    txComplete.store(true);
+    jobScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(jobScheduler.runPending());
+    EXPECT_TRUE(batch.succeeded());
+    EXPECT_EQ(jobScheduler.getStatus().backgroundJobsCompleted, 1U);
+    EXPECT_EQ(jobScheduler.getStatus().backgroundQueueDepth, 0U);
+}
+
+TEST_F(SlotTableSchedulerTest, RunPending_CoTaskAsSlotTask_ResumedEachSlot)
+{
+    std::atomic<bool> txComplete{false};
+    std::uint32_t frames = 0U;
+    Device::CoTask batch = transmitFrames(txComplete, frames);
+
+    Scheduler::TaskCallTable coTable{BusinessLogic::TickDelegate(batch),
+                                     BusinessLogic::TickDelegate(keyboard),
+                                     BusinessLogic::TickDelegate(recorder),
+                                     BusinessLogic::TickDelegate(recorder),
+                                     BusinessLogic::TickDelegate(recorder)};
+    Scheduler coScheduler{Scheduler::Config{SLOT_TABLE, coTable, MAX_CATCH_UP, MAX_SHED_CATCH_UP}};
+
+    ASSERT_TRUE(coScheduler.start());
+    coScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(coScheduler.runPending());
+    EXPECT_EQ(frames, 1U);
+
+    txComplete.store(true);
+    coScheduler.notifyTimeSlotIsr();
+    EXPECT_TRUE(coScheduler.runPending());
+    EXPECT_EQ(frames, 2U);
+    EXPECT_FALSE(batch.isDone());
+}
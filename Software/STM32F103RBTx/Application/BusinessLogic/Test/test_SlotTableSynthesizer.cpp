@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+import BusinessLogic.SlotTableScheduler;
+import BusinessLogic.SlotTableSynthesizer;
+import BusinessLogic.TaskId;
+
+import Driver.CycleBudget;
+
+namespace
+{
+    using BusinessLogic::AUTO_OFFSET;
+    using BusinessLogic::SynthesisError;
+    using BusinessLogic::TaskDeclaration;
+    using BusinessLogic::TaskId;
+
+    using Scheduler = BusinessLogic::SlotTableScheduler<4U, 2U>;
+
+    constexpr auto US_500 = Driver::CycleBudget::fromUs(500U);
+    constexpr auto US_200 = Driver::CycleBudget::fromUs(200U);
+
+    constexpr std::array<TaskDeclaration, 2U> APPLICATION_TASKS{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_500},
+        {.taskId = TaskId::KEYBOARD, .periodSlots = 2U, .offsetSlots = AUTO_OFFSET, .wcetCycles = US_200},
+    }};
+
+    template <std::size_t TaskCount>
+    consteval auto plan(const std::array<TaskDeclaration, TaskCount> &tasks)
+    {
+        return BusinessLogic::planSlots<Scheduler::SLOTS_PER_CYCLE, Scheduler::MAX_TASKS_PER_SLOT>(tasks);
+    }
+}
+
+// ==================== Placement Tests ====================
+
+TEST(SlotTableSynthesizerTest, ApplicationTasks_MatchAlternatingLayout)
+{
+    constexpr auto &table = BusinessLogic::SlotTableSynthesizer<Scheduler, APPLICATION_TASKS>::SLOT_TABLE;
+
+    for (std::size_t slot = 0U; slot < table.size(); ++slot)
+    {
+        EXPECT_EQ(table[slot].taskIds[0], TaskId::MEASUREMENT);
+
+        if ((slot % 2U) == 0U)
+        {
+            EXPECT_EQ(table[slot].taskIdCount, 2U);
+            EXPECT_EQ(table[slot].taskIds[1], TaskId::KEYBOARD);
+            EXPECT_EQ(table[slot].budgetCycles, US_500 + US_200);
+        }
+        else
+        {
+            EXPECT_EQ(table[slot].taskIdCount, 1U);
+            EXPECT_EQ(table[slot].budgetCycles, US_500);
+        }
+    }
+}
+
+TEST(SlotTableSynthesizerTest, AutoOffset_SpreadsLoadAcrossSlots)
+{
+    constexpr std::array<TaskDeclaration, 2U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 2U, .offsetSlots = AUTO_OFFSET, .wcetCycles = US_500},
+        {.taskId = TaskId::KEYBOARD, .periodSlots = 2U, .offsetSlots = AUTO_OFFSET, .wcetCycles = US_200},
+    }};
+
+    constexpr auto result = plan(tasks);
+
+    EXPECT_EQ(result.error, SynthesisError::NONE);
+    EXPECT_EQ(result.budgetCycles[0], US_500);
+    EXPECT_EQ(result.budgetCycles[1], US_200);
+    EXPECT_EQ(result.budgetCycles[2], US_500);
+    EXPECT_EQ(result.budgetCycles[3], US_200);
+}
+
+TEST(SlotTableSynthesizerTest, SlotKeepsDeclarationOrder)
+{
+    constexpr std::array<TaskDeclaration, 2U> tasks{{
+        {.taskId = TaskId::KEYBOARD, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_200},
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_500},
+    }};
+
+    constexpr auto result = plan(tasks);
+
+    EXPECT_EQ(result.error, SynthesisError::NONE);
+    EXPECT_EQ(result.taskIds[0][0], TaskId::KEYBOARD);
+    EXPECT_EQ(result.taskIds[0][1], TaskId::MEASUREMENT);
+}
+
+// ==================== Error Tests ====================
+
+TEST(SlotTableSynthesizerTest, BudgetAboveSlotPeriod_Rejected)
+{
+    constexpr std::array<TaskDeclaration, 2U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = Driver::CycleBudget::fromUs(3'000U)},
+        {.taskId = TaskId::KEYBOARD, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = Driver::CycleBudget::fromUs(2'500U)},
+    }};
+
+    static_assert(plan(tasks).error == SynthesisError::SLOT_BUDGET_EXCEEDED);
+}
+
+TEST(SlotTableSynthesizerTest, PeriodNotDividingCycle_Rejected)
+{
+    constexpr std::array<TaskDeclaration, 1U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 3U, .offsetSlots = 0U, .wcetCycles = US_200},
+    }};
+
+    static_assert(plan(tasks).error == SynthesisError::INVALID_PERIOD);
+}
+
+TEST(SlotTableSynthesizerTest, OffsetNotBelowPeriod_Rejected)
+{
+    constexpr std::array<TaskDeclaration, 1U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 2U, .offsetSlots = 2U, .wcetCycles = US_200},
+    }};
+
+    static_assert(plan(tasks).error == SynthesisError::INVALID_OFFSET);
+}
+
+TEST(SlotTableSynthesizerTest, DuplicateTask_Rejected)
+{
+    constexpr std::array<TaskDeclaration, 2U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_200},
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 2U, .offsetSlots = 1U, .wcetCycles = US_200},
+    }};
+
+    static_assert(plan(tasks).error == SynthesisError::DUPLICATE_TASK_ID);
+}
+
+TEST(SlotTableSynthesizerTest, InvalidTaskId_Rejected)
+{
+    constexpr std::array<TaskDeclaration, 1U> tasks{{
+        {.taskId = TaskId::LAST_NOT_USED, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_200},
+    }};
+
+    static_assert(plan(tasks).error == SynthesisError::INVALID_TASK_ID);
+}
+
+TEST(SlotTableSynthesizerTest, TooManyTasksInSlot_Rejected)
+{
+    using SingleTaskScheduler = BusinessLogic::SlotTableScheduler<2U, 1U>;
+
+    constexpr std::array<TaskDeclaration, 2U> tasks{{
+        {.taskId = TaskId::MEASUREMENT, .periodSlots = 1U, .offsetSlots = 0U, .wcetCycles = US_200},
+        {.taskId = TaskId::KEYBOARD, .periodSlots = 2U, .offsetSlots = AUTO_OFFSET, .wcetCycles = US_200},
+    }};
+
+    constexpr auto result = BusinessLogic::planSlots<SingleTaskScheduler::SLOTS_PER_CYCLE,
+                                                     SingleTaskScheduler::MAX_TASKS_PER_SLOT>(tasks);
+
+    static_assert(result.error == SynthesisError::TOO_MANY_TASKS_IN_SLOT);
+}
@@ -0,0 +1,381 @@
+/**
+ * @file CoTask.cppm
+ * @brief Coroutine task with frames taken from a fixed static arena.
+ */
+module;
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+export module Device.CoTask;
+
+export namespace Device
+{
+    /**
+     * @brief Fixed-block allocator for coroutine frames.
+     *
+     * @tparam BlockSize  Size of one frame block in bytes.
+     * @tparam BlockCount Number of frames that can be alive at the same time.
+     *
+     * @details
+     * The firmware is built with DISABLE_DYNAMIC_ALLOCATION, so coroutine frames cannot come
+     * from the heap. Each frame takes one block; a frame larger than BlockSize or a full arena
+     * makes the allocation fail and the coroutine is created as an invalid CoTask.
+     *
+     * Not ISR-safe: coroutines are created and destroyed from the main loop context only.
+     */
+    template <std::size_t BlockSize, std::size_t BlockCount>
+    class CoroutineArena final
+    {
+    public:
+        CoroutineArena() = delete;
+        ~CoroutineArena() = delete;
+        CoroutineArena(const CoroutineArena &) = delete;
+        CoroutineArena &operator=(const CoroutineArena &) = delete;
+        CoroutineArena(CoroutineArena &&) = delete;
+        CoroutineArena &operator=(CoroutineArena &&) = delete;
+
+        /// @brief Size of one frame block in bytes.
+        static constexpr std::size_t BLOCK_SIZE = BlockSize;
+
+        /// @brief Number of frame blocks.
+        static constexpr std::size_t BLOCK_COUNT = BlockCount;
+
+        /**
+         * @brief Takes one block for a frame of the given size.
+         *
+         * @return Block address, or nullptr if the frame is too large or no block is free.
+         */
+        [[nodiscard]] static auto allocate(std::size_t size) noexcept -> void *
+        {
+            void *result = nullptr;
+
+            if (size <= BlockSize) [[likely]]
+            {
+                for (std::size_t i = 0U; (i < BlockCount) && (result == nullptr); ++i)
+                {
+                    if (!used[i])
+                    {
+                        used[i] = true;
+                        ++usedCount;
+                        result = &storage[i * BlockSize];
+                    }
+                }
+            }
+
+            if (result == nullptr) [[unlikely]]
+            {
+                ++failedAllocations;
+            }
+            else if (usedCount > highWater)
+            {
+                highWater = usedCount;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns a block obtained from allocate(); nullptr and foreign pointers are ignored.
+         */
+        static auto deallocate(void *block) noexcept -> void
+        {
+            const auto *bytes = static_cast<const std::byte *>(block);
+
+            for (std::size_t i = 0U; i < BlockCount; ++i)
+            {
+                if ((bytes == &storage[i * BlockSize]) && used[i])
+                {
+                    used[i] = false;
+                    --usedCount;
+                }
+            }
+        }
+
+        /// @brief Number of frames currently alive.
+        [[nodiscard]] static auto getUsedBlocks() noexcept -> std::size_t
+        {
+            return usedCount;
+        }
+
+        /// @brief Highest number of frames alive at the same time.
+        [[nodiscard]] static auto getHighWater() noexcept -> std::size_t
+        {
+            return highWater;
+        }
+
+        /// @brief Number of coroutine creations that failed for lack of a suitable block.
+        [[nodiscard]] static auto getFailedAllocations() noexcept -> std::uint32_t
+        {
+            return failedAllocations;
+        }
+
+    private:
+        alignas(std::max_align_t) inline static std::array<std::byte, BlockSize * BlockCount> storage{};
+        inline static std::array<bool, BlockCount> used{};
+        inline static std::size_t usedCount{0U};
+        inline static std::size_t highWater{0U};
+        inline static std::uint32_t failedAllocations{0U};
+
+        static_assert(BlockCount > 0U, "CoroutineArena needs at least one block.");
+
+        static_assert((BlockSize % alignof(std::max_align_t)) == 0U,
+                      "BlockSize must keep every block aligned to std::max_align_t.");
+    };
+
+    /// @brief Frame block size of CoTask coroutines in bytes.
+    inline constexpr std::size_t CO_TASK_FRAME_SIZE{256U};
+
+    /// @brief Number of CoTask coroutines that can be alive at the same time.
+    inline constexpr std::size_t CO_TASK_FRAME_COUNT{4U};
+
+    /// @brief Arena all CoTask frames are taken from.
+    using CoTaskArena = CoroutineArena<CO_TASK_FRAME_SIZE, CO_TASK_FRAME_COUNT>;
+
+    /**
+     * @brief Cooperative coroutine task resumed once per scheduler slot.
+     *
+     * @details
+     * A coroutine returning CoTask starts suspended. Every tick() resumes it until the next
+     * suspension point, so a multi-slot operation (sector burst, multi-frame UART batch) can be
+     * written as straight-line code:
+     * @code
+     * auto sendBatch() -> Device::CoTask
+     * {
+     *     for (const auto &frame : frames)
+     *     {
+     *         startDmaTransmit(frame);
+     *         co_await Device::untilSet(txComplete); // set by the DMA complete ISR
+     *     }
+     *     co_return true;
+     * }
+     * @endcode
+     *
+     * - co_await nextSlot() yields until the next tick().
+     * - co_await untilSet(flag) yields until an ISR sets the atomic flag; while the flag is
+     *   clear tick() returns without resuming, so waiting costs one atomic load per slot.
+     * - co_return true/false reports success.
+     *
+     * tick() satisfies BusinessLogic::TickableConcept, so a CoTask can be bound to a slot task
+     * with TickDelegate or wrapped as a background job.
+     *
+     * Frames come from CoTaskArena. If the arena is exhausted the coroutine is not created and
+     * isValid() is false; tick() on such a task returns false.
+     */
+    class CoTask final
+    {
+    public:
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        /**
+         * @brief Coroutine promise; not used directly.
+         */
+        struct promise_type final
+        {
+            [[nodiscard]] static auto operator new(std::size_t size) noexcept -> void *
+            {
+                return CoTaskArena::allocate(size);
+            }
+
+            static auto operator delete(void *frame) noexcept -> void
+            {
+                CoTaskArena::deallocate(frame);
+            }
+
+            [[nodiscard]] static auto get_return_object_on_allocation_failure() noexcept -> CoTask
+            {
+                return CoTask{};
+            }
+
+            [[nodiscard]] auto get_return_object() noexcept -> CoTask
+            {
+                return CoTask{Handle::from_promise(*this)};
+            }
+
+            [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            [[nodiscard]] auto final_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            auto return_value(bool success) noexcept -> void
+            {
+                result = success;
+            }
+
+            // Unreachable: the firmware is built without exceptions.
+            [[noreturn]] auto unhandled_exception() const noexcept -> void
+            {
+                std::terminate();
+            }
+
+            /// @brief Flag awaited by untilSet(), nullptr when not waiting.
+            const std::atomic<bool> *waitFlag{nullptr};
+
+            /// @brief Value passed to co_return.
+            bool result{false};
+        };
+
+        /**
+         * @brief Awaitable that suspends until the next tick().
+         */
+        struct NextSlot final
+        {
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+                return false;
+            }
+
+            auto await_suspend(Handle) const noexcept -> void
+            {
+            }
+
+            auto await_resume() const noexcept -> void
+            {
+            }
+        };
+
+        /**
+         * @brief Awaitable that suspends until an atomic flag is set.
+         *
+         * @details
+         * The flag is not cleared; the coroutine clears it before starting the next operation.
+         */
+        struct UntilSet final
+        {
+            const std::atomic<bool> &flag;
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+                return flag.load(std::memory_order_acquire);
+            }
+
+            auto await_suspend(Handle handle) const noexcept -> void
+            {
+                handle.promise().waitFlag = &flag;
+            }
+
+            auto await_resume() const noexcept -> void
+            {
+            }
+        };
+
+        CoTask() noexcept = default;
+
+        ~CoTask()
+        {
+            destroy();
+        }
+
+        CoTask(const CoTask &) = delete;
+        CoTask &operator=(const CoTask &) = delete;
+
+        CoTask(CoTask &&other) noexcept
+            : handle(std::exchange(other.handle, nullptr))
+        {
+        }
+
+        CoTask &operator=(CoTask &&other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                handle = std::exchange(other.handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Resumes the coroutine once unless it is waiting for a flag that is still clear.
+         *
+         * @return false if the task is invalid or finished with co_return false; true otherwise.
+         */
+        [[nodiscard]] auto tick() noexcept -> bool
+        {
+            bool result = false;
+
+            if (handle) [[likely]]
+            {
+                if (!handle.done())
+                {
+                    promise_type &promise = handle.promise();
+
+                    const bool waiting = (promise.waitFlag != nullptr) &&
+                                         !promise.waitFlag->load(std::memory_order_acquire);
+
+                    if (!waiting)
+                    {
+                        promise.waitFlag = nullptr;
+                        handle.resume();
+                    }
+                }
+
+                result = !handle.done() || handle.promise().result;
+            }
+
+            return result;
+        }
+
+        /// @brief True if the coroutine frame was allocated.
+        [[nodiscard]] auto isValid() const noexcept -> bool
+        {
+            return static_cast<bool>(handle);
+        }
+
+        /// @brief True once the coroutine ran to co_return (false for an invalid task).
+        [[nodiscard]] auto isDone() const noexcept -> bool
+        {
+            return handle && handle.done();
+        }
+
+        /// @brief True once the coroutine finished with co_return true.
+        [[nodiscard]] auto succeeded() const noexcept -> bool
+        {
+            return isDone() && handle.promise().result;
+        }
+
+    private:
+        explicit CoTask(Handle newHandle) noexcept
+            : handle(newHandle)
+        {
+        }
+
+        auto destroy() noexcept -> void
+        {
+            if (handle)
+            {
+                handle.destroy();
+                handle = nullptr;
+            }
+        }
+
+        Handle handle{nullptr};
+    };
+
+    /**
+     * @brief Suspends a CoTask until the next scheduler slot.
+     */
+    [[nodiscard]] inline auto nextSlot() noexcept -> CoTask::NextSlot
+    {
+        return CoTask::NextSlot{};
+    }
+
+    /**
+     * @brief Suspends a CoTask until @p flag is set (e.g. by a DMA complete interrupt).
+     */
+    [[nodiscard]] inline auto untilSet(const std::atomic<bool> &flag) noexcept -> CoTask::UntilSet
+    {
+        return CoTask::UntilSet{flag};
+    }
+} // namespace Device
@@ -6,7 +6,12 @@ export import Device.Display;
 export import Device.Keyboard;
 export import Device.MeasurementDeviceId;
 export import Device.DisplayBrightness;
+export import Device.InterArrivalHistogram;
 export import Device.PulseCounterSource;
+export import Device.PulseRateEstimator;
+export import Device.PulseRateSource;
+export import Device.FrequencySource;
+export import Device.ReciprocalFrequencyMeter;
 export import Device.UartSource;
 export import Device.WiFiRecorder;
 export import Device.UartRecorder;
@@ -15,5 +20,10 @@ export import Device.SourceVariant;
 export import Device.RecorderVariant;
 export import Device.MeasurementSource;
 export import Device.MeasurementType;
+export import Device.MeasurementRecord;
+export import Device.MeasurementBatch;
+export import Device.MeasurementRollup;
+export import Device.TimestampCodec;
 export import Device.MeasurementRecorder;
 export import Device.KeyAction;
+export import Device.CoTask;
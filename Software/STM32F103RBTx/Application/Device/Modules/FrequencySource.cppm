@@ -0,0 +1,71 @@
+/**
+ * @file FrequencySource.cppm
+ * @brief Defines the FrequencySource class, which reports the frequency of a pulse counter input.
+ */
+module;
+
+#include <cstdint>
+
+export module Device.FrequencySource;
+
+import Device.DeviceComponent;
+import Device.MeasurementSource;
+import Device.MeasurementType;
+import Device.MeasurementDeviceId;
+import Device.ReciprocalFrequencyMeter;
+
+import Driver.PulseCounterDriver;
+
+export namespace Device
+{
+    /**
+     * @class FrequencySource
+     * @brief Reports the frequency of a pulse counter input by reciprocal counting.
+     *
+     * Reads the latest edge of the same driver as the PulseCounterSource of the input once
+     * per gate and feeds a ReciprocalFrequencyMeter. The measurement value is a Frequency
+     * (FREQUENCY_FRACTION_BITS fraction bits) in Hz; one measurement is available per gate.
+     */
+    class FrequencySource final : public DeviceComponent
+    {
+    public:
+        /**
+         * @brief Constructs a FrequencySource.
+         *
+         * @param deviceId           The unique identifier for this measurement source.
+         * @param pulseCounterDriver Driver of the counter input; it is started by its PulseCounterSource.
+         * @param gateMs             Gate length in milliseconds, at most ReciprocalFrequencyMeter::MAX_GATE_MS.
+         */
+        constexpr FrequencySource(
+            MeasurementDeviceId deviceId,
+            Driver::PulseCounterDriver &pulseCounterDriver,
+            std::uint32_t gateMs) noexcept
+            : deviceId{deviceId}, pulseCounterDriver{pulseCounterDriver}, meter{gateMs}
+        {
+        }
+
+        ~FrequencySource() = default;
+
+        // Non-copyable and non-movable
+        FrequencySource() = delete;
+        FrequencySource(const FrequencySource &) = delete;
+        FrequencySource(FrequencySource &&) = delete;
+        FrequencySource &operator=(const FrequencySource &) = delete;
+        FrequencySource &operator=(FrequencySource &&) = delete;
+
+        [[nodiscard]] auto onInit() noexcept -> bool;
+        [[nodiscard]] auto onStart() noexcept -> bool;
+        [[nodiscard]] auto onStop() noexcept -> bool;
+        [[nodiscard]] auto isMeasurementAvailable() const noexcept -> bool;
+        [[nodiscard]] auto getMeasurement() noexcept -> MeasurementType;
+
+    private:
+        MeasurementDeviceId deviceId;
+        Driver::PulseCounterDriver &pulseCounterDriver;
+        ReciprocalFrequencyMeter meter;
+    };
+
+    static_assert(Device::MeasurementSource<Device::FrequencySource>,
+                  "FrequencySource must satisfy MeasurementSource concept");
+
+} // namespace Device
@@ -0,0 +1,113 @@
+/**
+ * @file InterArrivalHistogram.cppm
+ * @brief Distribution of the time between consecutive captured pulses.
+ */
+module;
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+export module Device.InterArrivalHistogram;
+
+import Driver.PulseCapture;
+
+export namespace Device
+{
+    /**
+     * @brief Histogram of inter-arrival times with logarithmic bins.
+     *
+     * @details
+     * Bin 0 holds intervals of 0 ticks (two pulses within one tick). Bin b, 1 <= b <= 16,
+     * holds intervals in [2^(b-1), 2^b) ticks, so the bins cover the full tick range with
+     * the same relative resolution; the exponential distribution of a random pulse train
+     * shows as a straight edge. The last bin holds intervals known to be at least one capture
+     * timer period long, whose exact length the 16-bit ticks cannot tell.
+     *
+     * Ticks are fed in arrival order; the interval to the previous tick is kept across calls.
+     */
+    class InterArrivalHistogram final
+    {
+    public:
+        /// Number of bins, including the zero and the overflow bin.
+        static constexpr std::size_t BIN_COUNT{std::numeric_limits<Driver::CaptureTick>::digits + 2U};
+
+        /// Bin of the intervals longer than the capture timer period.
+        static constexpr std::size_t OVERFLOW_BIN{BIN_COUNT - 1U};
+
+        /**
+         * @brief Adds the intervals ending at each of @p ticks.
+         *
+         * The first tick after construction or restart() only starts the next interval.
+         */
+        constexpr auto add(std::span<const Driver::CaptureTick> ticks) noexcept -> void
+        {
+            for (const Driver::CaptureTick tick : ticks)
+            {
+                if (hasPrevious) [[likely]]
+                {
+                    const auto interval = static_cast<Driver::CaptureTick>(tick - previous);
+                    const std::size_t bin = longGap ? OVERFLOW_BIN : static_cast<std::size_t>(std::bit_width(interval));
+
+                    ++bins[bin];
+                    longGap = false;
+                }
+
+                previous = tick;
+                hasPrevious = true;
+            }
+        }
+
+        /**
+         * @brief Marks the next interval as longer than one capture timer period.
+         */
+        constexpr auto markLongGap() noexcept -> void
+        {
+            longGap = hasPrevious;
+        }
+
+        /**
+         * @brief Forgets the previous tick, e.g. after ticks were lost; the bins are kept.
+         */
+        constexpr auto restart() noexcept -> void
+        {
+            hasPrevious = false;
+            longGap = false;
+        }
+
+        /// @brief Empties all bins and forgets the previous tick.
+        constexpr auto clear() noexcept -> void
+        {
+            bins = {};
+            restart();
+        }
+
+        [[nodiscard]] constexpr auto getBins() const noexcept -> std::span<const std::uint32_t, BIN_COUNT>
+        {
+            return bins;
+        }
+
+        /// @brief Returns the number of intervals in all bins.
+        [[nodiscard]] constexpr auto getCount() const noexcept -> std::uint64_t
+        {
+            std::uint64_t result{0U};
+
+            for (const std::uint32_t bin : bins)
+            {
+                result += bin;
+            }
+
+            return result;
+        }
+
+    private:
+        std::array<std::uint32_t, BIN_COUNT> bins{};
+        Driver::CaptureTick previous{0U};
+        bool hasPrevious{false};
+        bool longGap{false};
+    };
+
+} // namespace Device
@@ -0,0 +1,169 @@
+/**
+ * @file MeasurementBatch.cppm
+ * @brief Fixed-capacity, column-wise (struct-of-arrays) buffer of measurements.
+ */
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module Device.MeasurementBatch;
+
+import Device.MeasurementDeviceId;
+import Device.MeasurementRecord;
+import Device.MeasurementType;
+
+import Driver.CycleCpu;
+
+export namespace Device
+{
+    /**
+     * @brief Read-only view of the columns of a MeasurementBatch.
+     *
+     * @details
+     * This is what recorders receive, so they do not depend on the batch capacity. All
+     * columns have the same length; element i of every column belongs to measurement i.
+     */
+    struct MeasurementColumns final
+    {
+        std::span<const MeasurementDeviceId> sources;
+        std::span<const ValueType> types;
+        std::span<const std::uint32_t> values;
+        std::span<const std::uint16_t> sequences;
+        std::span<const Driver::CycleTimestamp> timestamps;
+
+        /**
+         * @brief Views a single record as a batch of one.
+         *
+         * @param record Must outlive the view.
+         */
+        [[nodiscard]] static constexpr auto of(const MeasurementRecord &record) noexcept -> MeasurementColumns
+        {
+            return MeasurementColumns{
+                .sources = std::span{&record.source, 1U},
+                .types = std::span{&record.type, 1U},
+                .values = std::span{&record.value, 1U},
+                .sequences = std::span{&record.sequence, 1U},
+                .timestamps = std::span{&record.timestamp, 1U}};
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return sources.size();
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool
+        {
+            return sources.empty();
+        }
+
+        /**
+         * @brief Gathers measurement @p index into a record; @p index must be below size().
+         */
+        [[nodiscard]] constexpr auto getRecord(std::size_t index) const noexcept -> MeasurementRecord
+        {
+            return MeasurementRecord{
+                .timestamp = timestamps[index],
+                .value = values[index],
+                .sequence = sequences[index],
+                .source = sources[index],
+                .type = types[index]};
+        }
+    };
+
+    /**
+     * @brief Buffers up to Capacity measurements, one array per field.
+     *
+     * @tparam Capacity Maximum number of measurements.
+     *
+     * @details
+     * Loops over one field (all timestamps, all values, ...) walk contiguous memory with no
+     * variant dispatch, and the arrays need no padding between fields: 16 bytes per
+     * measurement. Meant to live in a member of its owner; it is too large for the stack at
+     * useful capacities.
+     */
+    template <std::size_t Capacity>
+    class MeasurementBatch final
+    {
+    public:
+        static_assert(Capacity > 0U, "MeasurementBatch needs room for at least one measurement");
+
+        /// @brief Maximum number of measurements.
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        /**
+         * @brief Appends a record.
+         * @return false if the batch is full; the record is not stored.
+         */
+        constexpr auto push(const MeasurementRecord &record) noexcept -> bool
+        {
+            const bool result = (count < Capacity);
+
+            if (result) [[likely]]
+            {
+                sources[count] = record.source;
+                types[count] = record.type;
+                values[count] = record.value;
+                sequences[count] = record.sequence;
+                timestamps[count] = record.timestamp;
+                ++count;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Appends a measurement.
+         * @return false if the batch is full; the measurement is not stored.
+         */
+        constexpr auto push(const MeasurementType &measurement) noexcept -> bool
+        {
+            return push(toRecord(measurement));
+        }
+
+        /// @brief Removes all measurements.
+        constexpr auto clear() noexcept -> void
+        {
+            count = 0U;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return count;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool
+        {
+            return count == 0U;
+        }
+
+        [[nodiscard]] constexpr auto isFull() const noexcept -> bool
+        {
+            return count == Capacity;
+        }
+
+        /**
+         * @brief Returns a view of the stored measurements; valid until the batch changes.
+         */
+        [[nodiscard]] constexpr auto getColumns() const noexcept -> MeasurementColumns
+        {
+            return MeasurementColumns{
+                .sources = std::span{sources}.first(count),
+                .types = std::span{types}.first(count),
+                .values = std::span{values}.first(count),
+                .sequences = std::span{sequences}.first(count),
+                .timestamps = std::span{timestamps}.first(count)};
+        }
+
+    private:
+        std::array<Driver::CycleTimestamp, Capacity> timestamps{};
+        std::array<std::uint32_t, Capacity> values{};
+        std::array<std::uint16_t, Capacity> sequences{};
+        std::array<MeasurementDeviceId, Capacity> sources{};
+        std::array<ValueType, Capacity> types{};
+        std::size_t count{0U};
+    };
+
+} // namespace Device
@@ -17,6 +17,14 @@ export namespace Device
         PULSE_COUNTER_3 = 2U, ///< Third pulse counter device.
         PULSE_COUNTER_4 = 3U, ///< Fourth pulse counter device.
         DEVICE_UART_1 = 4U,   ///< UART device.
-        LAST_NOT_USED = 5U    ///< Placeholder for upper bound or unused value.
+        PULSE_RATE_1 = 5U,    ///< Pulse rate of the first pulse counter input.
+        PULSE_RATE_2 = 6U,    ///< Pulse rate of the second pulse counter input.
+        PULSE_RATE_3 = 7U,    ///< Pulse rate of the third pulse counter input.
+        PULSE_RATE_4 = 8U,    ///< Pulse rate of the fourth pulse counter input.
+        FREQUENCY_1 = 9U,     ///< Reciprocal frequency of the first pulse counter input.
+        FREQUENCY_2 = 10U,    ///< Reciprocal frequency of the second pulse counter input.
+        FREQUENCY_3 = 11U,    ///< Reciprocal frequency of the third pulse counter input.
+        FREQUENCY_4 = 12U,    ///< Reciprocal frequency of the fourth pulse counter input.
+        LAST_NOT_USED = 13U   ///< Placeholder for upper bound or unused value.
     };
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+ * @file MeasurementRecord.cppm
+ * @brief Packed, trivially copyable form of a MeasurementType.
+ */
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+export module Device.MeasurementRecord;
+
+import Device.MeasurementDeviceId;
+import Device.MeasurementType;
+
+import Driver.CycleCpu;
+
+export namespace Device
+{
+    /**
+     * @enum ValueType
+     * @brief Width of the value carried by a MeasurementRecord.
+     *
+     * The order matches the alternatives of MeasurementType::DataVariant.
+     */
+    enum class ValueType : std::uint8_t
+    {
+        UINT16 = 0U, ///< Value fits in 16 bits.
+        UINT32 = 1U  ///< Full 32-bit value.
+    };
+
+    /**
+     * @brief Returns the number of bytes a value of the given type is serialized with.
+     */
+    [[nodiscard]] constexpr auto getValueSize(ValueType type) noexcept -> std::size_t
+    {
+        return (type == ValueType::UINT16) ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+    }
+
+    /**
+     * @brief Measurement stored without a variant.
+     *
+     * @details
+     * The value is always held in 32 bits and its original width is an explicit tag, so
+     * consumers read it with a plain load instead of a std::visit. Fields are ordered by
+     * alignment, so the record has no padding: 16 bytes against 24 for a MeasurementType.
+     */
+    struct MeasurementRecord final
+    {
+        /// Acquisition time, taken by the source when the value was read.
+        Driver::CycleTimestamp timestamp{0U};
+
+        std::uint32_t value{0U};
+
+        /// Per-source number assigned by the coordinator.
+        std::uint16_t sequence{0U};
+
+        MeasurementDeviceId source{MeasurementDeviceId::LAST_NOT_USED};
+        ValueType type{ValueType::UINT32};
+    };
+
+    static_assert(std::is_trivially_copyable_v<MeasurementRecord>, "MeasurementRecord must be trivially copyable");
+    static_assert(sizeof(MeasurementRecord) == 16U, "MeasurementRecord must stay free of padding");
+
+    /**
+     * @brief Packs a measurement into a record.
+     */
+    [[nodiscard]] constexpr auto toRecord(const MeasurementType &measurement) noexcept -> MeasurementRecord
+    {
+        MeasurementRecord record{
+            .timestamp = measurement.timestamp,
+            .sequence = measurement.sequence,
+            .source = measurement.source,
+            .type = static_cast<ValueType>(measurement.data.index())};
+
+        std::visit([&](const auto value) constexpr noexcept
+                   { record.value = value; }, measurement.data);
+
+        return record;
+    }
+
+    /**
+     * @brief Unpacks a record into a measurement with the same value type.
+     */
+    [[nodiscard]] constexpr auto toMeasurement(const MeasurementRecord &record) noexcept -> MeasurementType
+    {
+        MeasurementType measurement{
+            .source = record.source,
+            .data = record.value,
+            .sequence = record.sequence,
+            .timestamp = record.timestamp};
+
+        if (record.type == ValueType::UINT16)
+        {
+            measurement.data = static_cast<std::uint16_t>(record.value);
+        }
+
+        return measurement;
+    }
+
+} // namespace Device
@@ -8,9 +8,12 @@
 module;
 
 #include <concepts>
+#include <cstddef>
 
 export module Device.MeasurementRecorder;
 
+import Device.MeasurementBatch;
+import Device.MeasurementRecord;
 import Device.MeasurementType;
 import Device.DeviceComponent;
 
@@ -27,4 +30,48 @@ export namespace Device
         { t.notify(measurement) } noexcept -> std::same_as<bool>;
     };
 
+    /**
+     * @brief Concept for recorders that accept several measurements in one call
+     *
+     * Batching lets a recorder pay its per-transfer cost (UART transaction, f_write plus
+     * f_sync) once per batch instead of once per measurement. The batch arrives as the
+     * columns of a MeasurementBatch, so it is read without any variant dispatch.
+     */
+    template <typename T>
+    concept BatchMeasurementRecorder =
+        MeasurementRecorder<T> && requires(T t, MeasurementColumns measurements) {
+            { t.notifyBatch(measurements) } noexcept -> std::same_as<bool>;
+        };
+
+    /**
+     * @brief Passes a batch of measurements to any recorder
+     *
+     * Uses notifyBatch() when the recorder provides it, otherwise unpacks the measurements
+     * and calls notify() once per measurement, so single-item recorders work unchanged.
+     *
+     * @return false if the recorder rejected any measurement.
+     */
+    template <typename T>
+        requires requires(T t, const MeasurementType &measurement) {
+            { t.notify(measurement) } noexcept -> std::same_as<bool>;
+        }
+    [[nodiscard]] auto notifyBatch(T &recorder, MeasurementColumns measurements) noexcept -> bool
+    {
+        bool status{true};
+
+        if constexpr (requires { { recorder.notifyBatch(measurements) } noexcept -> std::same_as<bool>; })
+        {
+            status = recorder.notifyBatch(measurements);
+        }
+        else
+        {
+            for (std::size_t index = 0U; index < measurements.size(); ++index)
+            {
+                status = recorder.notify(toMeasurement(measurements.getRecord(index))) && status;
+            }
+        }
+
+        return status;
+    }
+
 } // namespace Device
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ * @file MeasurementRollup.cppm
+ * @brief Summary of the measurements of one source over a fixed time window.
+ */
+module;
+
+#include <cstdint>
+
+export module Device.MeasurementRollup;
+
+import Device.MeasurementDeviceId;
+
+import Driver.CycleCpu;
+
+export namespace Device
+{
+    /**
+     * @enum RollupTier
+     * @brief Window length of a MeasurementRollup.
+     */
+    enum class RollupTier : std::uint8_t
+    {
+        SECOND = 0U,       ///< 1 s windows.
+        MINUTE = 1U,       ///< 1 min windows.
+        HOUR = 2U,         ///< 1 h windows.
+        LAST_NOT_USED = 3U ///< Number of tiers.
+    };
+
+    /**
+     * @brief Minimum, maximum, sum and count of one source over one window.
+     *
+     * @details
+     * The mean is sum / count. Windows without measurements produce no rollup.
+     */
+    struct MeasurementRollup final
+    {
+        MeasurementDeviceId source{MeasurementDeviceId::LAST_NOT_USED};
+        RollupTier tier{RollupTier::SECOND};
+
+        /// Number of measurements in the window.
+        std::uint32_t count{0U};
+
+        std::uint32_t min{0U};
+        std::uint32_t max{0U};
+        std::uint64_t sum{0U};
+
+        /// Start of the window.
+        Driver::CycleTimestamp start{0U};
+    };
+
+} // namespace Device
@@ -7,6 +7,8 @@ export module Device.MeasurementType;
 
 import Device.MeasurementDeviceId;
 
+import Driver.CycleCpu;
+
 export namespace Device
 {
     struct MeasurementType final
@@ -15,6 +17,12 @@ export namespace Device
 
         MeasurementDeviceId source;
         DataVariant data;
+
+        /// Per-source number assigned by the coordinator; a gap at the receiver means lost measurements.
+        std::uint16_t sequence{0U};
+
+        /// Acquisition time, taken by the source when the value was read.
+        Driver::CycleTimestamp timestamp{0U};
     };
 
-} // namespace Device
\ No newline at end of file
+} // namespace Device
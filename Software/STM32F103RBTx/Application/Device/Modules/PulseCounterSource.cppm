@@ -3,6 +3,10 @@
  * @brief Defines the PulseCounterSource class responsible for managing measurements
  *        from a pulse counter device.
  */
+module;
+
+#include <cstdint>
+
 export module Device.PulseCounterSource;
 
 import Device.DeviceComponent;
@@ -20,6 +24,10 @@ export namespace Device
      *
      * The PulseCounterSource class interfaces with a pulse counter driver to initialize
      * the device, retrieve measurements, and manage the availability of new data.
+     *
+     * With gated sampling in the driver, a measurement is available once per gate and
+     * carries the count and time of that gate, so the counters of all connectors are
+     * reported for the same instant.
      */
     class PulseCounterSource final : public DeviceComponent
     {
@@ -55,6 +63,9 @@ export namespace Device
     private:
         MeasurementDeviceId deviceId;
         Driver::PulseCounterDriver &pulseCounterDriver;
+
+        /// Gate of the latest measurement; 0 while counts are read live.
+        std::uint32_t lastGate{0U};
     };
 
     static_assert(Device::MeasurementSource<Device::PulseCounterSource>,
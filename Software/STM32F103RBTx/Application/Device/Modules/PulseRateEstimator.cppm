@@ -0,0 +1,262 @@
+/**
+ * @file PulseRateEstimator.cppm
+ * @brief Fixed-point pulse rates over sliding windows, with optional dead-time correction.
+ */
+module;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+export module Device.PulseRateEstimator;
+
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+
+export namespace Device
+{
+    /// @brief Pulse rate in counts per time unit, unsigned fixed point with RATE_FRACTION_BITS fraction bits.
+    using PulseRate = std::uint32_t;
+
+    /// @brief Fraction bits of PulseRate; a resolution of 1/256 count per unit.
+    inline constexpr std::uint32_t RATE_FRACTION_BITS{8U};
+
+    /// @brief Rate reported when the value does not fit PulseRate or the detector is saturated.
+    inline constexpr PulseRate RATE_SATURATED{std::numeric_limits<PulseRate>::max()};
+
+    /**
+     * @brief Pulses counted in the last BucketCount completed buckets of BucketMs each.
+     *
+     * @details
+     * The window slides by one bucket at a time. A running sum keeps the cost per sample
+     * constant; only a sample that crosses a bucket boundary touches the bucket ring. Pulses
+     * are added to the bucket running when they are sampled.
+     */
+    template <std::size_t BucketCount, std::uint32_t BucketMs>
+    class SlidingCountWindow final
+    {
+    public:
+        /// @brief Bucket length in CPU cycles.
+        static constexpr Driver::CycleTimestamp BUCKET_CYCLES{
+            static_cast<Driver::CycleTimestamp>(BucketMs) * (Driver::coreHz / 1'000U)};
+
+        /**
+         * @brief Empties the window and starts the first bucket at @p now.
+         */
+        constexpr auto reset(Driver::CycleTimestamp now) noexcept -> void
+        {
+            buckets.fill(0U);
+            sum = 0U;
+            running = 0U;
+            position = 0U;
+            filled = 0U;
+            bucketEnd = now + BUCKET_CYCLES;
+        }
+
+        /**
+         * @brief Adds pulses to the running bucket and closes every bucket that ended by @p now.
+         *
+         * @return true if at least one bucket was closed, i.e. the window content changed.
+         */
+        constexpr auto add(Driver::PulseCount pulses, Driver::CycleTimestamp now) noexcept -> bool
+        {
+            const bool result = (now >= bucketEnd);
+
+            running += pulses;
+
+            if (result) [[unlikely]]
+            {
+                std::size_t closed{0U};
+
+                // After BucketCount empty buckets the window holds only zeros, so longer gaps
+                // are skipped in one step.
+                while ((now >= bucketEnd) && (closed < BucketCount))
+                {
+                    close();
+                    bucketEnd += BUCKET_CYCLES;
+                    ++closed;
+                }
+
+                if (now >= bucketEnd)
+                {
+                    bucketEnd += (((now - bucketEnd) / BUCKET_CYCLES) + 1U) * BUCKET_CYCLES;
+                }
+            }
+
+            return result;
+        }
+
+        /// @brief Pulses in the completed buckets of the window.
+        [[nodiscard]] constexpr auto getCount() const noexcept -> std::uint64_t
+        {
+            return sum;
+        }
+
+        /// @brief Time covered by the completed buckets, in milliseconds.
+        [[nodiscard]] constexpr auto getSpanMs() const noexcept -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(filled) * BucketMs;
+        }
+
+    private:
+        /// Moves the running bucket into the ring, replacing the oldest one.
+        constexpr auto close() noexcept -> void
+        {
+            sum = sum - buckets[position] + running;
+            buckets[position] = running;
+            running = 0U;
+            position = (position + 1U == BucketCount) ? 0U : (position + 1U);
+            filled = std::min(filled + 1U, BucketCount);
+        }
+
+        std::array<Driver::PulseCount, BucketCount> buckets{};
+        std::uint64_t sum{0U};
+        Driver::PulseCount running{0U};
+        std::size_t position{0U};
+        std::size_t filled{0U};
+        Driver::CycleTimestamp bucketEnd{BUCKET_CYCLES};
+
+        static_assert(BucketCount != 0U, "SlidingCountWindow needs at least one bucket.");
+        static_assert(BucketMs != 0U, "SlidingCountWindow bucket length must not be zero.");
+    };
+
+    /**
+     * @brief Turns samples of a cumulative pulse counter into counts per second and per minute.
+     *
+     * @details
+     * Counts per second come from a 1 s window of 100 ms buckets, counts per minute from a
+     * 60 s window of 5 s buckets. Until a window is full, the rate is scaled from the buckets
+     * completed so far. update() costs a subtraction and two additions per sample; the rates
+     * are recomputed in 64-bit integer arithmetic only when a bucket closes, as the Cortex-M3
+     * has no FPU.
+     *
+     * With a dead time τ set, the rates are corrected for a non-paralyzable detector:
+     * n = m / (1 - m·τ), with m the measured count over the window length. A window whose
+     * measured count implies a busy fraction of 100 % or more reports RATE_SATURATED.
+     */
+    class PulseRateEstimator final
+    {
+    public:
+        /**
+         * @param deadTimeNs Detector dead time in nanoseconds; 0 disables the correction.
+         */
+        explicit constexpr PulseRateEstimator(std::uint32_t deadTimeNs = 0U) noexcept
+            : deadTimeNs{deadTimeNs}
+        {
+        }
+
+        /**
+         * @brief Restarts both windows with @p count as the baseline of the counter.
+         */
+        constexpr auto reset(Driver::PulseCount count, Driver::CycleTimestamp now) noexcept -> void
+        {
+            lastCount = count;
+            second.reset(now);
+            minute.reset(now);
+            countsPerSecond = 0U;
+            countsPerMinute = 0U;
+        }
+
+        /**
+         * @brief Feeds one sample of the cumulative counter.
+         *
+         * @param count Counter value; it may wrap, the difference to the previous sample is used.
+         * @param now   Time of the sample.
+         */
+        constexpr auto update(Driver::PulseCount count, Driver::CycleTimestamp now) noexcept -> void
+        {
+            // Unsigned subtraction stays valid across the counter wrap.
+            const Driver::PulseCount pulses = count - lastCount;
+            lastCount = count;
+
+            if (second.add(pulses, now))
+            {
+                countsPerSecond = toRate(second.getCount(), second.getSpanMs(), MS_PER_SECOND);
+            }
+
+            if (minute.add(pulses, now))
+            {
+                countsPerMinute = toRate(minute.getCount(), minute.getSpanMs(), MS_PER_MINUTE);
+            }
+        }
+
+        /// @brief Counts per second over the last second, see RATE_FRACTION_BITS.
+        [[nodiscard]] constexpr auto getCountsPerSecond() const noexcept -> PulseRate
+        {
+            return countsPerSecond;
+        }
+
+        /// @brief Counts per minute over the last minute, see RATE_FRACTION_BITS.
+        [[nodiscard]] constexpr auto getCountsPerMinute() const noexcept -> PulseRate
+        {
+            return countsPerMinute;
+        }
+
+    private:
+        static constexpr std::uint32_t MS_PER_SECOND{1'000U};
+        static constexpr std::uint32_t MS_PER_MINUTE{60'000U};
+        static constexpr std::uint64_t NS_PER_MS{1'000'000U};
+
+        /// Fraction bits of the busy fraction m·τ in the dead-time correction.
+        static constexpr std::uint32_t BUSY_FRACTION_BITS{16U};
+        static constexpr std::uint64_t BUSY_ONE{std::uint64_t{1U} << BUSY_FRACTION_BITS};
+
+        /**
+         * @brief Converts the count of a window into a fixed-point rate per @p unitMs.
+         */
+        [[nodiscard]] constexpr auto toRate(std::uint64_t count,
+                                            std::uint32_t spanMs,
+                                            std::uint32_t unitMs) const noexcept -> PulseRate
+        {
+            PulseRate result{0U};
+
+            if (spanMs != 0U) [[likely]]
+            {
+                std::uint64_t corrected{count << RATE_FRACTION_BITS};
+                bool saturated{false};
+
+                if (deadTimeNs != 0U)
+                {
+                    const std::uint64_t spanNs = spanMs * NS_PER_MS;
+
+                    // Busy time m·τ; at or above the window length the detector was saturated.
+                    // The first test also keeps the product below 2^64.
+                    saturated = (count > (spanNs / deadTimeNs)) || ((count * deadTimeNs) >= spanNs);
+
+                    if (!saturated)
+                    {
+                        const std::uint64_t busy = ((count * deadTimeNs) << BUSY_FRACTION_BITS) / spanNs;
+
+                        corrected = (corrected << BUSY_FRACTION_BITS) / (BUSY_ONE - busy);
+                    }
+                }
+
+                saturated = saturated || (corrected > (std::numeric_limits<std::uint64_t>::max() / unitMs));
+
+                if (!saturated)
+                {
+                    result = static_cast<PulseRate>(
+                        std::min<std::uint64_t>((corrected * unitMs) / spanMs, RATE_SATURATED));
+                }
+                else
+                {
+                    result = RATE_SATURATED;
+                }
+            }
+
+            return result;
+        }
+
+        SlidingCountWindow<10U, 100U> second{};
+        SlidingCountWindow<12U, 5'000U> minute{};
+
+        std::uint32_t deadTimeNs;
+        Driver::PulseCount lastCount{0U};
+
+        PulseRate countsPerSecond{0U};
+        PulseRate countsPerMinute{0U};
+    };
+} // namespace Device
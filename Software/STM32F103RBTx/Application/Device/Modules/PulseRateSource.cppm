@@ -0,0 +1,85 @@
+/**
+ * @file PulseRateSource.cppm
+ * @brief Defines the PulseRateSource class, which reports the pulse rate of a pulse counter input.
+ */
+module;
+
+#include <cstdint>
+
+export module Device.PulseRateSource;
+
+import Device.DeviceComponent;
+import Device.MeasurementSource;
+import Device.MeasurementType;
+import Device.MeasurementDeviceId;
+import Device.PulseRateEstimator;
+
+import Driver.PulseCounterDriver;
+
+export namespace Device
+{
+    /**
+     * @brief Unit of the rate reported by a PulseRateSource.
+     */
+    enum class RateUnit : std::uint8_t
+    {
+        PER_SECOND = 0U, ///< Counts per second over the last second.
+        PER_MINUTE = 1U  ///< Counts per minute over the last minute.
+    };
+
+    /**
+     * @class PulseRateSource
+     * @brief Reports the rate of a pulse counter input as a fixed-point value.
+     *
+     * Samples the same driver as the PulseCounterSource of the input and feeds a
+     * PulseRateEstimator. The measurement value is a PulseRate (RATE_FRACTION_BITS fraction
+     * bits) in the configured unit, optionally corrected for the detector dead time. The value
+     * only changes when a window bucket closes, so a ReportMode::ON_CHANGE policy keeps the
+     * repeated values off the recorders.
+     */
+    class PulseRateSource final : public DeviceComponent
+    {
+    public:
+        /**
+         * @brief Constructs a PulseRateSource.
+         *
+         * @param deviceId           The unique identifier for this measurement source.
+         * @param pulseCounterDriver Driver of the counter input; it is started by its PulseCounterSource.
+         * @param unit               Unit of the reported rate.
+         * @param deadTimeNs         Detector dead time in nanoseconds; 0 disables the correction.
+         */
+        constexpr PulseRateSource(
+            MeasurementDeviceId deviceId,
+            Driver::PulseCounterDriver &pulseCounterDriver,
+            RateUnit unit = RateUnit::PER_SECOND,
+            std::uint32_t deadTimeNs = 0U) noexcept
+            : deviceId{deviceId}, pulseCounterDriver{pulseCounterDriver}, unit{unit}, estimator{deadTimeNs}
+        {
+        }
+
+        ~PulseRateSource() = default;
+
+        // Non-copyable and non-movable
+        PulseRateSource() = delete;
+        PulseRateSource(const PulseRateSource &) = delete;
+        PulseRateSource(PulseRateSource &&) = delete;
+        PulseRateSource &operator=(const PulseRateSource &) = delete;
+        PulseRateSource &operator=(PulseRateSource &&) = delete;
+
+        [[nodiscard]] auto onInit() noexcept -> bool;
+        [[nodiscard]] auto onStart() noexcept -> bool;
+        [[nodiscard]] auto onStop() noexcept -> bool;
+        [[nodiscard]] auto isMeasurementAvailable() const noexcept -> bool;
+        [[nodiscard]] auto getMeasurement() noexcept -> MeasurementType;
+
+    private:
+        MeasurementDeviceId deviceId;
+        Driver::PulseCounterDriver &pulseCounterDriver;
+        RateUnit unit;
+        PulseRateEstimator estimator;
+    };
+
+    static_assert(Device::MeasurementSource<Device::PulseRateSource>,
+                  "PulseRateSource must satisfy MeasurementSource concept");
+
+} // namespace Device
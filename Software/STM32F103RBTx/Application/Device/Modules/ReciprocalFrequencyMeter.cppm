@@ -0,0 +1,188 @@
+/**
+ * @file ReciprocalFrequencyMeter.cppm
+ * @brief Fixed-point frequency from the exact time between input edges.
+ */
+module;
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+export module Device.ReciprocalFrequencyMeter;
+
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+
+export namespace Device
+{
+    /// @brief Frequency in Hz, unsigned fixed point with FREQUENCY_FRACTION_BITS fraction bits.
+    using Frequency = std::uint32_t;
+
+    /// @brief Fraction bits of Frequency; a resolution of 15 uHz, up to 65.5 kHz.
+    inline constexpr std::uint32_t FREQUENCY_FRACTION_BITS{16U};
+
+    /// @brief Frequency reported when the value does not fit Frequency.
+    inline constexpr Frequency FREQUENCY_SATURATED{std::numeric_limits<Frequency>::max()};
+
+    /**
+     * @brief Reciprocal counter: measures the time of whole input periods instead of
+     *        counting pulses in a fixed time.
+     *
+     * @details
+     * Each gate ends with a reading of the latest edge (see Driver::PulseEdge). The frequency
+     * is the number of edges since the latest edge of the previous gate, divided by the
+     * cycles between both edges. The measurement therefore starts and stops on an edge,
+     * covers whole periods, and has no dead time between gates. Its resolution is one core
+     * cycle over the gate (14 ns/s, 0.014 ppm with a 1 s gate) whatever the input frequency,
+     * where counting pulses in the same gate resolves only 1 Hz.
+     *
+     * That holds for exact edge times. Timed edges are stamped by the EXTI interrupt, which
+     * shares priority 0 with TIM2, USB, DMA and the TIM1 and TIM4 counting interrupts and
+     * cannot preempt them; an edge arriving during one of those handlers, or while the main
+     * loop masks interrupts, is stamped when it ends. The resolution is therefore bounded by
+     * that latency (a few us, so about 10 ppm with a 1 s gate) rather than by one cycle.
+     *
+     * A gate without edges keeps the reference edge and the frequency, so inputs slower than
+     * one edge per gate are measured over several gates, down to about one edge per
+     * MAX_GATE_MS. Only once no edge came for MAX_GATE_MS does the input read 0 Hz; the next
+     * edge then only restarts the measurement, as does a change between timed and untimed
+     * readings (Driver::PulseEdge::edgeTimed), where the frequency is kept meanwhile.
+     * Untimed readings give the pulse count over the time between readings, with the usual
+     * resolution of one pulse per gate.
+     *
+     * Not interrupt safe: all calls must come from the same execution context.
+     */
+    class ReciprocalFrequencyMeter final
+    {
+    public:
+        /// @brief Longest gate, and longest time without edges before an input reads 0 Hz.
+        /// A measurement then spans less than three of them, within one cycle counter wrap (59 s).
+        static constexpr std::uint32_t MAX_GATE_MS{10'000U};
+
+        /**
+         * @param gateMs Gate length in milliseconds, clamped to [1, MAX_GATE_MS].
+         */
+        explicit constexpr ReciprocalFrequencyMeter(std::uint32_t gateMs) noexcept
+            : gateCycles{static_cast<Driver::CycleTimestamp>(std::clamp(gateMs, 1U, MAX_GATE_MS)) *
+                         (Driver::coreHz / 1'000U)}
+        {
+        }
+
+        /**
+         * @brief Takes @p edge as baseline and opens the first gate at @p now.
+         */
+        constexpr auto reset(const Driver::PulseEdge &edge, Driver::CycleTimestamp now) noexcept -> void
+        {
+            last = edge;
+            hasReference = false;
+            frequency = 0U;
+            referenceTime = now;
+            gateEnd = now + gateCycles;
+        }
+
+        /// @brief true once the current gate has ended at @p now.
+        [[nodiscard]] constexpr auto isGateClosed(Driver::CycleTimestamp now) const noexcept -> bool
+        {
+            return now >= gateEnd;
+        }
+
+        /**
+         * @brief Ends the current gate with @p edge, read at @p now, and opens the next one.
+         */
+        constexpr auto update(const Driver::PulseEdge &edge, Driver::CycleTimestamp now) noexcept -> void
+        {
+            const Driver::PulseCount edges = edge.count - last.count;
+
+            if (edge.edgeTimed != last.edgeTimed) [[unlikely]]
+            {
+                // The counts come from different counters.
+                hasReference = false;
+            }
+            else if (edges == 0U)
+            {
+                // Keep measuring from the reference until the input is considered stopped.
+                if ((now - referenceTime) >= TIMEOUT_CYCLES)
+                {
+                    frequency = 0U;
+                    hasReference = false;
+                }
+            }
+            else
+            {
+                if (hasReference) [[likely]]
+                {
+                    frequency = toFrequency(edge.count - reference.count,
+                                            static_cast<Driver::CycleCpu>(edge.cycles - reference.cycles));
+                }
+
+                reference = edge;
+                referenceTime = now;
+                hasReference = true;
+            }
+
+            last = edge;
+
+            gateEnd += gateCycles;
+
+            // A late update skips the gates it missed rather than catching up.
+            if (gateEnd <= now) [[unlikely]]
+            {
+                gateEnd = now + gateCycles;
+            }
+        }
+
+        /// @brief Frequency of the latest complete measurement.
+        [[nodiscard]] constexpr auto getFrequency() const noexcept -> Frequency
+        {
+            return frequency;
+        }
+
+        /**
+         * @brief Returns @p edges / @p cycles in Hz, rounded to the nearest fixed-point step.
+         */
+        [[nodiscard]] static constexpr auto toFrequency(Driver::PulseCount edges, Driver::CycleCpu cycles) noexcept
+            -> Frequency
+        {
+            Frequency result{FREQUENCY_SATURATED};
+
+            if (cycles != 0U) [[likely]]
+            {
+                // scaled stays below 2^59 and the remainder below 2^32, so nothing overflows.
+                const std::uint64_t scaled = static_cast<std::uint64_t>(edges) * Driver::coreHz;
+                const std::uint64_t hertz = scaled / cycles;
+                const std::uint64_t fraction =
+                    (((scaled % cycles) << FREQUENCY_FRACTION_BITS) + (cycles / 2U)) / cycles;
+                const std::uint64_t value = (hertz << FREQUENCY_FRACTION_BITS) + fraction;
+
+                if ((hertz < (1ULL << (32U - FREQUENCY_FRACTION_BITS))) &&
+                    (value <= std::numeric_limits<Frequency>::max()))
+                {
+                    result = static_cast<Frequency>(value);
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        static constexpr Driver::CycleTimestamp TIMEOUT_CYCLES{
+            static_cast<Driver::CycleTimestamp>(MAX_GATE_MS) * (Driver::coreHz / 1'000U)};
+
+        Driver::CycleTimestamp gateCycles;
+        Driver::CycleTimestamp gateEnd{0U};
+
+        /// Reading at the end of the previous gate.
+        Driver::PulseEdge last{};
+
+        /// Edge the running measurement starts from; valid when hasReference.
+        Driver::PulseEdge reference{};
+        bool hasReference{false};
+
+        /// End of the gate in which the reference edge was read.
+        Driver::CycleTimestamp referenceTime{0U};
+
+        Frequency frequency{0U};
+    };
+
+} // namespace Device
@@ -1,8 +1,22 @@
+module;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <utility>
+
 export module Device.SdCardRecorder;
 
+import Device.CoTask;
 import Device.DeviceComponent;
+import Device.MeasurementBatch;
+import Device.MeasurementRecord;
 import Device.MeasurementRecorder;
+import Device.MeasurementRollup;
 import Device.MeasurementType;
+import Device.TimestampCodec;
 
 import Driver.SdCardDriver;
 import Driver.SdCardStatus;
@@ -15,6 +29,13 @@ export namespace Device
      *
      * The SdCardRecorder class interacts with an SD card driver to store measurement data.
      * It provides methods for writing, flushing, and managing the lifecycle of the recording process.
+     *
+     * Measurements go to the raw log. Rollups go to one file per RollupTier, so coarse data
+     * can be read without scanning the raw log. The driver keeps one file open at a time,
+     * so a rollup write closes the raw log, appends to the tier file and reopens the raw log.
+     * Those are several FatFs calls of up to a few ms each, so rollups are written by a
+     * coroutine that makes one call per step. Measurements received meanwhile are buffered
+     * and written after the raw log is reopened.
      */
     class SdCardRecorder final : public DeviceComponent
     {
@@ -46,6 +67,55 @@ export namespace Device
          */
         [[nodiscard]] auto notify(const MeasurementType &measurement) noexcept -> bool;
 
+        /**
+         * @brief Writes several measurements with as few SD card writes as possible.
+         *
+         * The CSV lines are collected in a buffer and written (f_write plus f_sync) once per
+         * full buffer instead of once per measurement. The first line of every write carries
+         * the absolute timestamp, the others a delta to the line before, so each write can be
+         * decoded on its own.
+         *
+         * While a writeRollups() task holds the raw log closed, the measurements are kept in
+         * a buffer of PENDING_CAPACITY measurements instead and written by the task.
+         *
+         * @return True if all measurements were written or buffered; false otherwise, and none
+         *         of them is buffered if they do not all fit.
+         */
+        [[nodiscard]] auto notifyBatch(MeasurementColumns measurements) noexcept -> bool;
+
+        /// @brief Measurements buffered while a rollup write holds the raw log closed.
+        static constexpr std::size_t PENDING_CAPACITY{144U};
+
+        /**
+         * @brief Returns the worst-case number of ticks a writeRollups() task for @p rollups
+         *        makes up to the one reopening the raw log.
+         */
+        [[nodiscard]] static consteval auto getRollupWriteSlices(std::size_t rollups) noexcept -> std::size_t
+        {
+            const std::size_t tiers = std::min(rollups, ROLLUP_FILENAMES.size());
+
+            // Close, then open, writes and close per tier, then reopen.
+            return 1U + (2U * tiers) + (tiers + (rollups / ROLLUP_LINES_PER_WRITE)) + 1U;
+        }
+
+        /**
+         * @brief Returns a task appending rollups to the file of their tier.
+         *
+         * Each tick() of the task makes one SD card call (close, open, write of a full buffer),
+         * so it can run as a background job in the slot slack. Consecutive rollups of the same
+         * tier are written with one file switch, so callers should pass all rollups closed at
+         * the same time in one call.
+         *
+         * The raw log is closed from the first tick() until it is reopened; notifyBatch()
+         * buffers the measurements meanwhile, and the task writes them after the reopen, one
+         * buffer per tick. No other rollup write may run meanwhile, and @p rollups must stay
+         * valid.
+         *
+         * @return Task finishing with true if all rollups were written and the raw log was
+         *         reopened; invalid if no coroutine frame was free.
+         */
+        [[nodiscard]] auto writeRollups(std::span<const MeasurementRollup> rollups) noexcept -> CoTask;
+
         /**
          * @brief Initializes the SdCardRecorder.
          *
@@ -71,11 +141,84 @@ export namespace Device
         [[nodiscard]] auto onStop() noexcept -> bool;
 
     private:
+        /// Longest CSV line: "255,4294967295,T18446744073709551615,65535\n".
+        static constexpr std::size_t MAX_LINE_SIZE{48U};
+
+        /// Lines written with one SD card write.
+        static constexpr std::size_t LINES_PER_WRITE{16U};
+
+        /// Longest rollup line: "255,4294967295,4294967295,4294967295,18446744073709551615,T18446744073709551615\n".
+        static constexpr std::size_t MAX_ROLLUP_LINE_SIZE{80U};
+
+        /// Rollup lines that fit the CSV buffer at least.
+        static constexpr std::size_t ROLLUP_LINES_PER_WRITE{
+            (((MAX_LINE_SIZE * LINES_PER_WRITE) - MAX_ROLLUP_LINE_SIZE) / MAX_ROLLUP_LINE_SIZE) + 1U};
+
+        /// Raw log; filenames must be strict, up to 8 chars + '.' + up to 3 chars.
+        static constexpr std::string_view RAW_FILENAME{"0:/DAT01.TXT"};
+
+        /// Rollup file per RollupTier. Appended across restarts to cover long deployments.
+        static constexpr std::array<std::string_view, std::to_underlying(RollupTier::LAST_NOT_USED)> ROLLUP_FILENAMES{
+            "0:/ROLL1S.TXT",
+            "0:/ROLL1M.TXT",
+            "0:/ROLL1H.TXT"};
+
+        /**
+         * @brief Formats one measurement as "source,value,timestamp,sequence\n".
+         *
+         * @details
+         * The timestamp column is "T<cycles>" for an absolute timestamp and "+<cycles>" for a
+         * delta to the previous line. The sequence column is the per-source number assigned by
+         * the coordinator; a gap marks lost measurements.
+         *
+         * @return Number of characters written, or 0 if @p output is too small.
+         */
+        [[nodiscard]] static auto formatLine(const MeasurementRecord &record,
+                                             TimestampCode timestampCode,
+                                             std::span<char> output) noexcept -> std::size_t;
+
+        /**
+         * @brief Formats measurements from @p next on into the CSV buffer, until it is full.
+         *
+         * The first line carries the absolute timestamp.
+         *
+         * @param next   Index of the first measurement; advanced past the formatted ones.
+         * @param status Cleared if a measurement could not be formatted.
+         * @return Number of characters in the buffer.
+         */
+        [[nodiscard]] auto formatLines(MeasurementColumns measurements,
+                                       std::size_t &next,
+                                       bool &status) noexcept -> std::size_t;
+
+        /**
+         * @brief Formats one rollup as "source,count,min,max,sum,T<start>\n".
+         *
+         * @return Number of characters written, or 0 if @p output is too small.
+         */
+        [[nodiscard]] static auto formatRollupLine(const MeasurementRollup &rollup,
+                                                   std::span<char> output) noexcept -> std::size_t;
+
+        /**
+         * @brief Writes the first @p size buffered characters to the SD card.
+         */
+        [[nodiscard]] auto writeBuffer(std::size_t size) noexcept -> bool;
+
         Driver::SdCardDriver &driver;
+
+        std::array<char, MAX_LINE_SIZE * LINES_PER_WRITE> csvBuffer{};
+
+        /// Measurements received while the raw log is closed.
+        MeasurementBatch<PENDING_CAPACITY> pending{};
+
+        /// True while a rollup write holds the raw log closed.
+        bool rawLogClosed{false};
+
+        static_assert(MAX_ROLLUP_LINE_SIZE <= (MAX_LINE_SIZE * LINES_PER_WRITE),
+                      "A rollup line must fit the CSV buffer.");
     };
 
     // Compile-time verification
-    static_assert(MeasurementRecorder<SdCardRecorder>,
-                  "SdCardRecorder must satisfy MeasurementRecorder concept");
+    static_assert(BatchMeasurementRecorder<SdCardRecorder>,
+                  "SdCardRecorder must satisfy BatchMeasurementRecorder concept");
 
 } // namespace Device
\ No newline at end of file
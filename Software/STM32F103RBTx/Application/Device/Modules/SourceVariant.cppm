@@ -9,7 +9,9 @@ module;
 
 export module Device.SourceVariant;
 
+import Device.FrequencySource;
 import Device.PulseCounterSource;
+import Device.PulseRateSource;
 import Device.UartSource;
 
 export namespace Device
@@ -22,6 +24,8 @@ export namespace Device
      */
     using SourceVariant = std::variant<
         std::reference_wrapper<Device::PulseCounterSource>,
+        std::reference_wrapper<Device::PulseRateSource>,
+        std::reference_wrapper<Device::FrequencySource>,
         std::reference_wrapper<Device::UartSource>>;
 
 } // namespace Device
\ No newline at end of file
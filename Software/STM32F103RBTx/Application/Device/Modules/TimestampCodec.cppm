@@ -0,0 +1,201 @@
+/**
+ * @file TimestampCodec.cppm
+ * @brief Compact encoding of measurement timestamps for recorder output.
+ */
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module Device.TimestampCodec;
+
+import Driver.CycleCpu;
+
+export namespace Device
+{
+    /**
+     * @brief Timestamp in compact form.
+     *
+     * @details
+     * Bit 0 set: bits 63..1 hold the absolute timestamp. Bit 0 clear: bits 63..1 hold the
+     * difference to the previous timestamp of the same sequence. Deltas between neighbouring
+     * measurements are small, so with VarintCodec they take 2-3 bytes instead of 8.
+     */
+    using TimestampCode = std::uint64_t;
+
+    /// @brief True if the code holds an absolute timestamp.
+    [[nodiscard]] constexpr auto isAbsolute(TimestampCode code) noexcept -> bool
+    {
+        return (code & 1U) != 0U;
+    }
+
+    /// @brief Returns the absolute timestamp or the delta held by the code.
+    [[nodiscard]] constexpr auto getCodeValue(TimestampCode code) noexcept -> std::uint64_t
+    {
+        return code >> 1U;
+    }
+
+    /**
+     * @brief Turns a sequence of timestamps into absolute and delta codes.
+     *
+     * @details
+     * The first timestamp after reset() is absolute, later ones are deltas to their
+     * predecessor. Recorders reset at the start of every self-contained output unit (UART
+     * transaction, SD card write), so losing one unit does not corrupt the next. A timestamp
+     * older than its predecessor is written as absolute.
+     */
+    class TimestampEncoder final
+    {
+    public:
+        /// @brief Makes the next timestamp absolute.
+        constexpr auto reset() noexcept -> void
+        {
+            hasReference = false;
+        }
+
+        [[nodiscard]] constexpr auto encode(Driver::CycleTimestamp timestamp) noexcept -> TimestampCode
+        {
+            TimestampCode result{(timestamp << 1U) | 1U};
+
+            if (hasReference && (timestamp >= previous)) [[likely]]
+            {
+                result = (timestamp - previous) << 1U;
+            }
+
+            previous = timestamp;
+            hasReference = true;
+
+            return result;
+        }
+
+    private:
+        Driver::CycleTimestamp previous{0U};
+        bool hasReference{false};
+    };
+
+    /**
+     * @brief Rebuilds absolute timestamps from the codes of TimestampEncoder.
+     */
+    class TimestampDecoder final
+    {
+    public:
+        /// @brief Forgets the reference; the next code must be absolute.
+        constexpr auto reset() noexcept -> void
+        {
+            hasReference = false;
+        }
+
+        /**
+         * @param code      Code read from the recorder output.
+         * @param timestamp Absolute timestamp, written on success.
+         * @return false if the code is a delta and no absolute code was seen since reset().
+         */
+        [[nodiscard]] constexpr auto decode(TimestampCode code, Driver::CycleTimestamp &timestamp) noexcept -> bool
+        {
+            const bool absolute = isAbsolute(code);
+            const bool result = absolute || hasReference;
+
+            if (result)
+            {
+                previous = absolute ? getCodeValue(code) : (previous + getCodeValue(code));
+                hasReference = true;
+                timestamp = previous;
+            }
+
+            return result;
+        }
+
+    private:
+        Driver::CycleTimestamp previous{0U};
+        bool hasReference{false};
+    };
+
+    /**
+     * @brief LEB128 variable-length encoding of unsigned 64-bit values.
+     *
+     * @details
+     * Seven value bits per byte, least significant group first; the top bit marks that more
+     * bytes follow.
+     */
+    class VarintCodec final
+    {
+    public:
+        /// @brief Largest encoded size of a 64-bit value.
+        static constexpr std::size_t MAX_SIZE{10U};
+
+        /**
+         * @return Number of bytes written, or 0 if @p output is too small.
+         */
+        [[nodiscard]] static constexpr auto encode(std::uint64_t value, std::span<std::uint8_t> output) noexcept
+            -> std::size_t
+        {
+            std::size_t cursor{0U};
+            bool more = true;
+
+            while (more && (cursor < output.size()))
+            {
+                const auto group = static_cast<std::uint8_t>(value & GROUP_MASK);
+                value >>= GROUP_BITS;
+                more = (value != 0U);
+
+                output[cursor++] = more ? static_cast<std::uint8_t>(group | CONTINUATION) : group;
+            }
+
+            return more ? 0U : cursor;
+        }
+
+        /**
+         * @return Number of bytes consumed, or 0 if the input is truncated or longer than MAX_SIZE.
+         */
+        [[nodiscard]] static constexpr auto decode(std::span<const std::uint8_t> input, std::uint64_t &value) noexcept
+            -> std::size_t
+        {
+            std::uint64_t result{0U};
+            std::size_t cursor{0U};
+            bool more = true;
+
+            while (more && (cursor < input.size()) && (cursor < MAX_SIZE))
+            {
+                const std::uint8_t byte = input[cursor];
+
+                result |= static_cast<std::uint64_t>(byte & GROUP_MASK) << (cursor * GROUP_BITS);
+                more = (byte & CONTINUATION) != 0U;
+                ++cursor;
+            }
+
+            if (!more)
+            {
+                value = result;
+            }
+
+            return more ? 0U : cursor;
+        }
+
+        [[nodiscard]] static constexpr auto getSize(std::uint64_t value) noexcept -> std::size_t
+        {
+            std::size_t result{1U};
+
+            while (value > GROUP_MASK)
+            {
+                value >>= GROUP_BITS;
+                ++result;
+            }
+
+            return result;
+        }
+
+        VarintCodec() = delete;
+        ~VarintCodec() = delete;
+        VarintCodec(const VarintCodec &) = delete;
+        VarintCodec &operator=(const VarintCodec &) = delete;
+        VarintCodec(VarintCodec &&) = delete;
+        VarintCodec &operator=(VarintCodec &&) = delete;
+
+    private:
+        static constexpr std::size_t GROUP_BITS{7U};
+        static constexpr std::uint8_t GROUP_MASK{0x7FU};
+        static constexpr std::uint8_t CONTINUATION{0x80U};
+    };
+
+} // namespace Device
@@ -6,15 +6,20 @@
 module;
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 export module Device.WiFiRecorder;
 
 import Device.DeviceComponent;
+import Device.MeasurementBatch;
+import Device.MeasurementRecord;
 import Device.MeasurementRecorder;
 import Device.WiFiSerializer;
 import Device.MeasurementType;
 import Device.CobsEncoder;
+import Device.TimestampCodec;
 
 import Driver.UartDriver;
 
@@ -48,6 +53,16 @@ export namespace Device
 
         [[nodiscard]] auto notify(const MeasurementType &measurement) noexcept -> bool;
 
+        /**
+         * @brief Sends several measurements with as few UART transactions as possible.
+         *
+         * Each measurement is still its own COBS frame, so the ESP side parses the stream
+         * unchanged; up to FRAMES_PER_TRANSMIT frames share one transmit() call. The first
+         * frame of a transmit() call carries the absolute timestamp, the others a delta to the
+         * frame before.
+         */
+        [[nodiscard]] auto notifyBatch(MeasurementColumns measurements) noexcept -> bool;
+
         [[nodiscard]] auto onInit() noexcept -> bool;
 
         [[nodiscard]] auto onStart() noexcept -> bool;
@@ -65,13 +80,24 @@ export namespace Device
 
         static constexpr std::uint32_t UART_TX_TIMEOUT_MS{1000};
 
+        /// COBS frames sent with one UART transaction.
+        static constexpr std::size_t FRAMES_PER_TRANSMIT{8U};
+
+        /**
+         * @brief Serializes and COBS encodes one measurement into @p output.
+         * @return Encoded frame size, or 0 on failure.
+         */
+        [[nodiscard]] auto encodeFrame(const MeasurementRecord &record,
+                                       TimestampCode timestampCode,
+                                       std::span<std::uint8_t> output) noexcept -> std::size_t;
+
         // Buffers with compile-time calculated sizes
         std::array<std::uint8_t, MAX_SERIALIZED_SIZE> serializedBuffer{};
-        std::array<std::uint8_t, MAX_COBS_ENCODED_SIZE> cobsEncodedBuffer{};
+        std::array<std::uint8_t, MAX_COBS_ENCODED_SIZE * FRAMES_PER_TRANSMIT> cobsEncodedBuffer{};
     };
 
     // Compile-time verification
-    static_assert(MeasurementRecorder<WiFiRecorder>,
-                  "WiFiRecorder must satisfy MeasurementRecorder concept");
+    static_assert(BatchMeasurementRecorder<WiFiRecorder>,
+                  "WiFiRecorder must satisfy BatchMeasurementRecorder concept");
 
 } // namespace Device
\ No newline at end of file
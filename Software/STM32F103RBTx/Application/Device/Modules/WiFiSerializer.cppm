@@ -1,6 +1,7 @@
 module;
 
 #include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <expected>
@@ -10,8 +11,10 @@ module;
 
 export module Device.WiFiSerializer;
 
+import Device.MeasurementRecord;
 import Device.MeasurementType;
 import Device.Crc32;
+import Device.TimestampCodec;
 
 export namespace Device
 {
@@ -26,22 +29,24 @@ export namespace Device
     public:
         /**
          * @brief Serializes a measurement into the provided buffer.
-         * Format: [Length (2, LE)][SourceID (1)][Value (N, LE)][CRC (4, LE)]
+         * Format: [Length (2, LE)][SourceID (1)][Sequence (2, LE)][Value (N, LE)][Timestamp (1..10)][CRC (4, LE)]
          *
          * All multi-byte values are serialized in Little Endian for STM32/ESP32 compatibility.
+         * The timestamp is a TimestampCode in VarintCodec form: absolute in the first frame of
+         * a transmission, a delta to the previous frame after that. A gap in the sequence of
+         * one source means measurements were lost before or during transmission.
          *
-         * @param measurement Input data.
+         * @param record Input data.
+         * @param timestampCode Timestamp of the measurement, from a TimestampEncoder.
          * @param output Output buffer span.
          * @return Number of bytes written, or error.
          */
         [[nodiscard]] static constexpr std::expected<std::size_t, SerializationError> serialize(
-            const MeasurementType &measurement,
+            const MeasurementRecord &record,
+            TimestampCode timestampCode,
             std::span<std::uint8_t> output) noexcept
         {
-            const std::size_t valueSize = std::visit([]<typename T>(const T &) constexpr noexcept
-                                                     { return sizeof(T); }, measurement.data);
-
-            const std::size_t requiredSize = PROTOCOL_OVERHEAD + valueSize;
+            const std::size_t requiredSize = getSerializedSize(record, timestampCode);
 
             if (requiredSize > output.size()) [[unlikely]]
             {
@@ -51,10 +56,19 @@ export namespace Device
             std::size_t cursor{0};
 
             writeLittleEndian(static_cast<std::uint16_t>(requiredSize), output, cursor);
-            output[cursor++] = static_cast<std::uint8_t>(measurement.source);
+            output[cursor++] = static_cast<std::uint8_t>(record.source);
+            writeLittleEndian(record.sequence, output, cursor);
+
+            if (record.type == ValueType::UINT16)
+            {
+                writeLittleEndian(static_cast<std::uint16_t>(record.value), output, cursor);
+            }
+            else
+            {
+                writeLittleEndian(record.value, output, cursor);
+            }
 
-            std::visit([&]<typename T>(const T &val) constexpr noexcept
-                       { writeLittleEndian(val, output, cursor); }, measurement.data);
+            cursor += VarintCodec::encode(timestampCode, output.subspan(cursor));
 
             const std::uint32_t crcCalc = Crc32::compute(output.subspan(0, cursor));
             writeLittleEndian(crcCalc, output, cursor);
@@ -62,16 +76,47 @@ export namespace Device
             return cursor;
         }
 
+        /**
+         * @brief Serializes a measurement; same frame as for its MeasurementRecord.
+         */
+        [[nodiscard]] static constexpr std::expected<std::size_t, SerializationError> serialize(
+            const MeasurementType &measurement,
+            TimestampCode timestampCode,
+            std::span<std::uint8_t> output) noexcept
+        {
+            return serialize(toRecord(measurement), timestampCode, output);
+        }
+
+        /**
+         * @brief Serializes a measurement with its absolute timestamp.
+         */
+        [[nodiscard]] static constexpr std::expected<std::size_t, SerializationError> serialize(
+            const MeasurementType &measurement,
+            std::span<std::uint8_t> output) noexcept
+        {
+            TimestampEncoder encoder{};
+
+            return serialize(measurement, encoder.encode(measurement.timestamp), output);
+        }
+
         /**
          * @brief Calculates the exact serialized size for a measurement.
          */
         [[nodiscard]] static constexpr std::size_t getSerializedSize(
-            const MeasurementType &measurement) noexcept
+            const MeasurementRecord &record,
+            TimestampCode timestampCode) noexcept
         {
-            const std::size_t valueSize = std::visit([]<typename T>(const T &) constexpr noexcept
-                                                     { return sizeof(T); }, measurement.data);
+            return PROTOCOL_OVERHEAD + getValueSize(record.type) + VarintCodec::getSize(timestampCode);
+        }
 
-            return PROTOCOL_OVERHEAD + valueSize;
+        /**
+         * @brief Calculates the exact serialized size for a measurement.
+         */
+        [[nodiscard]] static constexpr std::size_t getSerializedSize(
+            const MeasurementType &measurement,
+            TimestampCode timestampCode) noexcept
+        {
+            return getSerializedSize(toRecord(measurement), timestampCode);
         }
 
         /**
@@ -79,7 +124,7 @@ export namespace Device
          */
         [[nodiscard]] static consteval std::size_t getMaxSerializedSize() noexcept
         {
-            return PROTOCOL_OVERHEAD + getMaxVariantSize<MeasurementType::DataVariant>();
+            return PROTOCOL_OVERHEAD + getMaxVariantSize<MeasurementType::DataVariant>() + VarintCodec::MAX_SIZE;
         }
 
         WiFiSerializer() = delete;
@@ -92,8 +137,9 @@ export namespace Device
     private:
         static constexpr std::size_t FIELD_LEN_SIZE{2};
         static constexpr std::size_t FIELD_SRC_SIZE{1};
+        static constexpr std::size_t FIELD_SEQ_SIZE{2};
         static constexpr std::size_t FIELD_CRC_SIZE{4};
-        static constexpr std::size_t PROTOCOL_OVERHEAD{FIELD_LEN_SIZE + FIELD_SRC_SIZE + FIELD_CRC_SIZE};
+        static constexpr std::size_t PROTOCOL_OVERHEAD{FIELD_LEN_SIZE + FIELD_SRC_SIZE + FIELD_SEQ_SIZE + FIELD_CRC_SIZE};
 
         static constexpr std::uint8_t BITS_PER_BYTE{8};
         static constexpr std::uint8_t BYTE_MASK{0xFF};
@@ -0,0 +1,48 @@
+module Device.FrequencySource;
+
+import Device.MeasurementType;
+import Device.MeasurementDeviceId;
+import Device.ReciprocalFrequencyMeter;
+
+import Driver.CycleClock;
+import Driver.PulseCount;
+import Driver.PulseCounterDriver;
+
+namespace Device
+{
+
+    auto FrequencySource::onInit() noexcept -> bool
+    {
+        return true;
+    }
+
+    auto FrequencySource::onStart() noexcept -> bool
+    {
+        meter.reset(pulseCounterDriver.readLastEdge(), Driver::CycleClock::timestamp());
+
+        return true;
+    }
+
+    auto FrequencySource::onStop() noexcept -> bool
+    {
+        return true;
+    }
+
+    auto FrequencySource::isMeasurementAvailable() const noexcept -> bool
+    {
+        return meter.isGateClosed(Driver::CycleClock::timestamp());
+    }
+
+    auto FrequencySource::getMeasurement() noexcept -> MeasurementType
+    {
+        const Driver::PulseEdge edge = pulseCounterDriver.readLastEdge();
+        const Driver::CycleTimestamp now = Driver::CycleClock::timestamp();
+
+        meter.update(edge, now);
+
+        return MeasurementType{
+            .source = deviceId,
+            .data = meter.getFrequency(),
+            .timestamp = now};
+    }
+}
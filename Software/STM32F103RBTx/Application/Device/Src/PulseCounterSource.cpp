@@ -1,8 +1,13 @@
+module;
+
+#include <cstdint>
+
 module Device.PulseCounterSource;
 
 import Device.MeasurementType;
 import Device.MeasurementDeviceId;
 
+import Driver.PulseCount;
 import Driver.PulseCounterDriver;
 
 namespace Device
@@ -25,13 +30,20 @@ namespace Device
 
     auto PulseCounterSource::isMeasurementAvailable() const noexcept -> bool
     {
-        return true;
+        const std::uint32_t gate = pulseCounterDriver.getGate();
+
+        return (gate == 0U) || (gate != lastGate);
     }
 
     auto PulseCounterSource::getMeasurement() noexcept -> MeasurementType
     {
+        const Driver::PulseSample sample = pulseCounterDriver.readSample();
+
+        lastGate = sample.gate;
+
         return MeasurementType{
             .source = deviceId,
-            .data = pulseCounterDriver.read()};
+            .data = sample.count,
+            .timestamp = sample.timestamp};
     }
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+module Device.PulseRateSource;
+
+import Device.MeasurementType;
+import Device.MeasurementDeviceId;
+import Device.PulseRateEstimator;
+
+import Driver.PulseCount;
+import Driver.PulseCounterDriver;
+
+namespace Device
+{
+
+    auto PulseRateSource::onInit() noexcept -> bool
+    {
+        return true;
+    }
+
+    auto PulseRateSource::onStart() noexcept -> bool
+    {
+        // The counter source clears the driver on start; take whatever it holds as baseline.
+        const Driver::PulseSample sample = pulseCounterDriver.readSample();
+
+        estimator.reset(sample.count, sample.timestamp);
+
+        return true;
+    }
+
+    auto PulseRateSource::onStop() noexcept -> bool
+    {
+        return true;
+    }
+
+    auto PulseRateSource::isMeasurementAvailable() const noexcept -> bool
+    {
+        return true;
+    }
+
+    auto PulseRateSource::getMeasurement() noexcept -> MeasurementType
+    {
+        // The gate time with gated sampling, so the rate is not skewed by when the gate is read.
+        const Driver::PulseSample sample = pulseCounterDriver.readSample();
+
+        estimator.update(sample.count, sample.timestamp);
+
+        const PulseRate rate = (unit == RateUnit::PER_MINUTE) ? estimator.getCountsPerMinute()
+                                                              : estimator.getCountsPerSecond();
+
+        return MeasurementType{
+            .source = deviceId,
+            .data = rate,
+            .timestamp = sample.timestamp};
+    }
+}
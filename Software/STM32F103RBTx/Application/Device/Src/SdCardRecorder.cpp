@@ -6,10 +6,16 @@ module;
 #include <cstdint>
 #include <span>
 #include <string_view>
-#include <variant>
+#include <utility>
 
 module Device.SdCardRecorder;
 
+import Device.CoTask;
+import Device.MeasurementBatch;
+import Device.MeasurementRecord;
+import Device.MeasurementRollup;
+import Device.TimestampCodec;
+
 import Driver.FileOpenMode;
 import Driver.SdCardStatus;
 
@@ -22,13 +28,9 @@ namespace Device
 
     auto SdCardRecorder::onStart() noexcept -> bool
     {
-        using FileOpenMode = Driver::FileOpenMode;
-        // filenames must be strict, up to 8 chars + '.' + up to 3 chars
-        static constexpr std::string_view FILENAME{"0:/DAT01.TXT"};
-        static constexpr FileOpenMode MODE{FileOpenMode::OVERWRITE}; // todo fix it
-
+        // Appended like the rollup files, so a restart keeps the data recorded before it.
         const bool status = driver.start() &&
-                            (driver.openFile(FILENAME, MODE) == Driver::SdCardStatus::OK);
+                            (driver.openFile(RAW_FILENAME, Driver::FileOpenMode::APPEND) == Driver::SdCardStatus::OK);
 
         return status;
     }
@@ -40,61 +42,292 @@ namespace Device
 
     auto SdCardRecorder::notify(const MeasurementType &measurement) noexcept -> bool
     {
-        static constexpr std::size_t BUFFER_SIZE{64};
-        std::array<char, BUFFER_SIZE> csvBuffer{};
+        const MeasurementRecord record = toRecord(measurement);
+
+        return notifyBatch(MeasurementColumns::of(record));
+    }
+
+    auto SdCardRecorder::notifyBatch(MeasurementColumns measurements) noexcept -> bool
+    {
+        bool status{true};
+
+        if (rawLogClosed)
+        {
+            status = (measurements.size() <= (PENDING_CAPACITY - pending.size()));
+
+            for (std::size_t index = 0U; status && (index < measurements.size()); ++index)
+            {
+                static_cast<void>(pending.push(measurements.getRecord(index)));
+            }
+        }
+        else
+        {
+            std::size_t next{0U};
+
+            while (next < measurements.size())
+            {
+                const std::size_t size = formatLines(measurements, next, status);
+
+                if (size != 0U)
+                {
+                    status = writeBuffer(size) && status;
+                }
+            }
+        }
+
+        return status;
+    }
+
+    auto SdCardRecorder::writeRollups(std::span<const MeasurementRollup> rollups) noexcept -> CoTask
+    {
+        bool status{true};
+
+        if (!rollups.empty())
+        {
+            status = (driver.closeFile() == Driver::SdCardStatus::OK);
+            rawLogClosed = true;
+
+            std::size_t first{0U};
+
+            while (first < rollups.size())
+            {
+                std::size_t last{first + 1U};
+
+                while ((last < rollups.size()) && (rollups[last].tier == rollups[first].tier))
+                {
+                    ++last;
+                }
+
+                co_await nextSlot();
+
+                const auto tierIndex = std::to_underlying(rollups[first].tier);
+                const bool opened = (tierIndex < ROLLUP_FILENAMES.size()) &&
+                                    (driver.openFile(ROLLUP_FILENAMES[tierIndex], Driver::FileOpenMode::APPEND) ==
+                                     Driver::SdCardStatus::OK);
+
+                if (opened)
+                {
+                    std::size_t offset{0};
+
+                    for (std::size_t index = first; index < last; ++index)
+                    {
+                        if ((csvBuffer.size() - offset) < MAX_ROLLUP_LINE_SIZE)
+                        {
+                            co_await nextSlot();
+
+                            status = writeBuffer(offset) && status;
+                            offset = 0U;
+                        }
+
+                        const std::size_t length = formatRollupLine(rollups[index],
+                                                                    std::span{csvBuffer}.subspan(offset));
+
+                        status = status && (length != 0U);
+                        offset += length;
+                    }
+
+                    if (offset != 0U)
+                    {
+                        co_await nextSlot();
+
+                        status = writeBuffer(offset) && status;
+                    }
+
+                    co_await nextSlot();
+
+                    status = (driver.closeFile() == Driver::SdCardStatus::OK) && status;
+                }
+
+                status = opened && status;
+                first = last;
+            }
+
+            co_await nextSlot();
+
+            // The raw log is reopened even after a failed rollup write, so measurements keep flowing.
+            status = (driver.openFile(RAW_FILENAME, Driver::FileOpenMode::APPEND) == Driver::SdCardStatus::OK) &&
+                     status;
+
+            // Measurements keep arriving until the last buffer is written, so the columns are
+            // taken again on every tick.
+            std::size_t next{0U};
+
+            while (next < pending.size())
+            {
+                co_await nextSlot();
+
+                const std::size_t size = formatLines(pending.getColumns(), next, status);
+
+                if (size != 0U)
+                {
+                    status = writeBuffer(size) && status;
+                }
+            }
+
+            pending.clear();
+            rawLogClosed = false;
+        }
+
+        co_return status;
+    }
+
+    auto SdCardRecorder::formatRollupLine(const MeasurementRollup &rollup,
+                                          std::span<char> output) noexcept -> std::size_t
+    {
+        const std::array<std::uint64_t, 5U> columns{
+            static_cast<std::uint8_t>(rollup.source),
+            rollup.count,
+            rollup.min,
+            rollup.max,
+            rollup.sum};
+
+        char *cursor = output.data();
+        char *const end = output.data() + output.size();
+        bool status{true};
+
+        for (const std::uint64_t column : columns)
+        {
+            const auto columnResult = std::to_chars(cursor, end, column);
+
+            status = status && (columnResult.ec == std::errc{}) && (columnResult.ptr < end);
+
+            if (status) [[likely]]
+            {
+                cursor = columnResult.ptr;
+                *cursor++ = ',';
+            }
+        }
+
+        status = status && (cursor < end);
+
+        if (status) [[likely]]
+        {
+            *cursor++ = 'T';
+
+            const auto startResult = std::to_chars(cursor, end, rollup.start);
+
+            status = (startResult.ec == std::errc{}) && (startResult.ptr < end);
+
+            if (status) [[likely]]
+            {
+                cursor = startResult.ptr;
+                *cursor++ = '\n';
+            }
+        }
+
+        return status ? static_cast<std::size_t>(cursor - output.data()) : 0U;
+    }
+
+    auto SdCardRecorder::formatLines(MeasurementColumns measurements,
+                                     std::size_t &next,
+                                     bool &status) noexcept -> std::size_t
+    {
+        std::size_t offset{0};
+        TimestampEncoder timestamps{};
+
+        while ((next < measurements.size()) && ((csvBuffer.size() - offset) >= MAX_LINE_SIZE))
+        {
+            const MeasurementRecord record = measurements.getRecord(next);
+            const std::size_t length = formatLine(record,
+                                                  timestamps.encode(record.timestamp),
+                                                  std::span{csvBuffer}.subspan(offset));
+
+            if (length == 0U) [[unlikely]]
+            {
+                timestamps.reset();
+            }
+
+            status = status && (length != 0U);
+            offset += length;
+            ++next;
+        }
+
+        return offset;
+    }
+
+    auto SdCardRecorder::writeBuffer(std::size_t size) noexcept -> bool
+    {
+        const std::span<const std::uint8_t> writeData{
+            reinterpret_cast<const std::uint8_t *>(csvBuffer.data()),
+            size};
+
+        return (driver.write(writeData) == Driver::SdCardStatus::OK);
+    }
+
+    auto SdCardRecorder::formatLine(const MeasurementRecord &record,
+                                    TimestampCode timestampCode,
+                                    std::span<char> output) noexcept -> std::size_t
+    {
         std::size_t offset{0};
-        bool status{false};
+        std::size_t result{0};
 
         // Convert source ID to string
         const auto sourceResult = std::to_chars(
-            csvBuffer.data() + offset,
-            csvBuffer.data() + csvBuffer.size(),
-            static_cast<std::uint8_t>(measurement.source));
+            output.data() + offset,
+            output.data() + output.size(),
+            static_cast<std::uint8_t>(record.source));
 
         if (sourceResult.ec == std::errc{}) [[likely]]
         {
-            offset = sourceResult.ptr - csvBuffer.data();
+            offset = sourceResult.ptr - output.data();
 
-            if (offset < csvBuffer.size()) [[likely]]
+            if (offset < output.size()) [[likely]]
             {
-                csvBuffer[offset++] = ',';
+                output[offset++] = ',';
 
-                // Convert measurement data to string
-                const bool conversionSuccess = std::visit(
-                    [&]<typename T>(const T &value) constexpr noexcept -> bool
-                    {
-                        const auto dataResult = std::to_chars(
-                            csvBuffer.data() + offset,
-                            csvBuffer.data() + csvBuffer.size(),
-                            value);
+                // The value column is the same for both value types; the tag only sets its wire width.
+                const auto dataResult = std::to_chars(
+                    output.data() + offset,
+                    output.data() + output.size(),
+                    record.value);
 
-                        if (dataResult.ec == std::errc{})
-                        {
-                            offset = dataResult.ptr - csvBuffer.data();
-                            return true;
-                        }
-                        return false;
-                    },
-                    measurement.data);
+                const bool conversionSuccess = (dataResult.ec == std::errc{});
 
                 if (conversionSuccess) [[likely]]
                 {
-                    if (offset < csvBuffer.size()) [[likely]]
+                    offset = dataResult.ptr - output.data();
+                }
+
+                if (conversionSuccess && ((offset + 2U) < output.size())) [[likely]]
+                {
+                    output[offset++] = ',';
+                    output[offset++] = isAbsolute(timestampCode) ? 'T' : '+';
+
+                    const auto timestampResult = std::to_chars(
+                        output.data() + offset,
+                        output.data() + output.size(),
+                        getCodeValue(timestampCode));
+
+                    if (timestampResult.ec == std::errc{}) [[likely]]
                     {
-                        csvBuffer[offset++] = '\n';
+                        offset = timestampResult.ptr - output.data();
+
+                        if (offset < output.size()) [[likely]]
+                        {
+                            output[offset++] = ',';
 
-                        // Write to SD card
-                        const std::span<const std::uint8_t> writeData{
-                            reinterpret_cast<const std::uint8_t *>(csvBuffer.data()),
-                            offset};
+                            const auto sequenceResult = std::to_chars(
+                                output.data() + offset,
+                                output.data() + output.size(),
+                                record.sequence);
 
-                        status = (driver.write(writeData) == Driver::SdCardStatus::OK);
+                            if (sequenceResult.ec == std::errc{}) [[likely]]
+                            {
+                                offset = sequenceResult.ptr - output.data();
+
+                                if (offset < output.size()) [[likely]]
+                                {
+                                    output[offset++] = '\n';
+                                    result = offset;
+                                }
+                            }
+                        }
                     }
                 }
             }
         }
 
-        return status;
+        return result;
     }
 
 } // namespace Device
\ No newline at end of file
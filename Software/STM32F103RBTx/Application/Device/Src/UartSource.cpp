@@ -8,6 +8,7 @@ import Device.MeasurementSource;
 import Device.MeasurementType;
 import Device.MeasurementDeviceId;
 
+import Driver.CycleClock;
 import Driver.UartDriver;
 
 namespace Device
@@ -50,6 +51,7 @@ namespace Device
 
         return MeasurementType{
             .source = deviceId,
-            .data = DUMMY_DATA};
+            .data = DUMMY_DATA,
+            .timestamp = Driver::CycleClock::timestamp()};
     }
 }
\ No newline at end of file
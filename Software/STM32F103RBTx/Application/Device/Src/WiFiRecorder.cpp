@@ -1,11 +1,15 @@
 module;
 
+#include <cstddef>
 #include <span>
 
 module Device.WiFiRecorder;
+import Device.MeasurementBatch;
+import Device.MeasurementRecord;
 import Device.MeasurementType;
 import Device.WiFiSerializer;
 import Device.CobsEncoder;
+import Device.TimestampCodec;
 
 import Driver.DriverComponent;
 import Driver.UartDriver;
@@ -35,11 +39,76 @@ namespace Device
 
     auto WiFiRecorder::notify(const Device::MeasurementType &measurement) noexcept -> bool
     {
-        bool success = false;
+        const MeasurementRecord record = toRecord(measurement);
+
+        return notifyBatch(MeasurementColumns::of(record));
+    }
+
+    auto WiFiRecorder::notifyBatch(MeasurementColumns measurements) noexcept -> bool
+    {
+        bool success = true;
+        std::size_t offset{0};
+        TimestampEncoder timestamps{};
+
+        const auto transmitBuffered = [&]() noexcept -> bool
+        {
+            return (driver.transmit(
+                        std::span{cobsEncodedBuffer.data(), offset},
+                        UART_TX_TIMEOUT_MS) == Driver::UartStatus::Ok);
+        };
+
+        for (std::size_t index = 0U; index < measurements.size(); ++index)
+        {
+            const MeasurementRecord record = measurements.getRecord(index);
+
+            if ((cobsEncodedBuffer.size() - offset) < MAX_COBS_ENCODED_SIZE)
+            {
+                success = transmitBuffered() && success;
+                offset = 0U;
+            }
+
+            // Every transmission starts with an absolute timestamp, so it decodes on its own.
+            if (offset == 0U)
+            {
+                timestamps.reset();
+            }
+
+            const std::size_t encodedSize =
+                encodeFrame(record,
+                            timestamps.encode(record.timestamp),
+                            std::span{cobsEncodedBuffer}.subspan(offset));
+
+            if (encodedSize == 0U) [[unlikely]]
+            {
+                // The receiver never sees this frame; do not let the next delta refer to it.
+                timestamps.reset();
+            }
+
+            success = success && (encodedSize != 0U);
+            offset += encodedSize;
+        }
+
+        if (offset != 0U)
+        {
+            success = transmitBuffered() && success;
+        }
+
+        static_cast<void>(success);
+
+        return true;
+        // return success;
+    }
+
+    auto WiFiRecorder::encodeFrame(const MeasurementRecord &record,
+                                   TimestampCode timestampCode,
+                                   std::span<std::uint8_t> output) noexcept -> std::size_t
+    {
+        std::size_t result{0};
 
         // Step 1: Serialize the measurement
         auto serializeResult = WiFiSerializer::serialize(
-            measurement,
+            record,
+            timestampCode,
             std::span{serializedBuffer});
 
         if (serializeResult)
@@ -49,20 +118,14 @@ namespace Device
             // Step 2: COBS encode the serialized data
             auto encodeResult = CobsEncoder::encode(
                 std::span{serializedBuffer.data(), serializedSize},
-                std::span{cobsEncodedBuffer});
+                output);
 
             if (encodeResult)
             {
-                const std::size_t encodedSize = *encodeResult;
-
-                // Step 3: Transmit via UART
-                success = (driver.transmit(
-                               std::span{cobsEncodedBuffer.data(), encodedSize},
-                               UART_TX_TIMEOUT_MS) == Driver::UartStatus::Ok);
+                result = *encodeResult;
             }
         }
 
-        return true;
-        // return success;
+        return result;
     }
 }
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+import Device.CoTask;
+
+namespace
+{
+    auto countSlots(std::uint32_t &steps, std::uint32_t slots) -> Device::CoTask
+    {
+        for (std::uint32_t i = 0U; i < slots; ++i)
+        {
+            ++steps;
+            co_await Device::nextSlot();
+        }
+
+        co_return true;
+    }
+
+    auto waitForFlag(const std::atomic<bool> &flag, std::uint32_t &steps) -> Device::CoTask
+    {
+        ++steps;
+        co_await Device::untilSet(flag);
+        ++steps;
+        co_return true;
+    }
+
+    auto failImmediately() -> Device::CoTask
+    {
+        co_return false;
+    }
+}
+
+// ==================== Resume Tests ====================
+
+TEST(CoTaskTest, StartsSuspended)
+{
+    std::uint32_t steps = 0U;
+    Device::CoTask task = countSlots(steps, 2U);
+
+    EXPECT_TRUE(task.isValid());
+    EXPECT_FALSE(task.isDone());
+    EXPECT_EQ(steps, 0U);
+}
+
+TEST(CoTaskTest, Tick_ResumesOnceUntilDone)
+{
+    std::uint32_t steps = 0U;
+    Device::CoTask task = countSlots(steps, 2U);
+
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 1U);
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 2U);
+    EXPECT_FALSE(task.isDone());
+
+    EXPECT_TRUE(task.tick());
+    EXPECT_TRUE(task.isDone());
+    EXPECT_TRUE(task.succeeded());
+
+    // Finished tasks are not resumed again.
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 2U);
+}
+
+TEST(CoTaskTest, CoReturnFalse_TickReportsFailure)
+{
+    Device::CoTask task = failImmediately();
+
+    EXPECT_FALSE(task.tick());
+    EXPECT_TRUE(task.isDone());
+    EXPECT_FALSE(task.succeeded());
+}
+
+TEST(CoTaskTest, UntilSet_WaitsForFlag)
+{
+    std::atomic<bool> dmaComplete{false};
+    std::uint32_t steps = 0U;
+    Device::CoTask task = waitForFlag(dmaComplete, steps);
+
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 1U);
+
+    EXPECT_TRUE(task.tick()); // flag still clear: not resumed
+    EXPECT_EQ(steps, 1U);
+
+    dmaComplete.store(true);
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 2U);
+    EXPECT_TRUE(task.succeeded());
+}
+
+TEST(CoTaskTest, UntilSet_FlagAlreadySet_DoesNotSuspend)
+{
+    std::atomic<bool> dmaComplete{true};
+    std::uint32_t steps = 0U;
+    Device::CoTask task = waitForFlag(dmaComplete, steps);
+
+    EXPECT_TRUE(task.tick());
+    EXPECT_EQ(steps, 2U);
+    EXPECT_TRUE(task.isDone());
+}
+
+// ==================== Arena Tests ====================
+
+TEST(CoTaskTest, Arena_FrameReturnedOnDestruction)
+{
+    const std::size_t usedBefore = Device::CoTaskArena::getUsedBlocks();
+    std::uint32_t steps = 0U;
+
+    {
+        Device::CoTask task = countSlots(steps, 1U);
+        EXPECT_EQ(Device::CoTaskArena::getUsedBlocks(), usedBefore + 1U);
+    }
+
+    EXPECT_EQ(Device::CoTaskArena::getUsedBlocks(), usedBefore);
+}
+
+TEST(CoTaskTest, Arena_Exhausted_TaskInvalid)
+{
+    std::uint32_t steps = 0U;
+    std::array<Device::CoTask, Device::CO_TASK_FRAME_COUNT> tasks{};
+
+    for (Device::CoTask &task : tasks)
+    {
+        task = countSlots(steps, 1U);
+        ASSERT_TRUE(task.isValid());
+    }
+
+    const std::uint32_t failedBefore = Device::CoTaskArena::getFailedAllocations();
+    Device::CoTask extra = countSlots(steps, 1U);
+
+    EXPECT_FALSE(extra.isValid());
+    EXPECT_FALSE(extra.tick());
+    EXPECT_EQ(Device::CoTaskArena::getFailedAllocations(), failedBefore + 1U);
+    EXPECT_EQ(Device::CoTaskArena::getHighWater(), Device::CO_TASK_FRAME_COUNT);
+}
+
+TEST(CoTaskTest, MoveAssignment_TransfersFrame)
+{
+    std::uint32_t steps = 0U;
+    Device::CoTask first = countSlots(steps, 1U);
+    Device::CoTask second{};
+
+    second = std::move(first);
+
+    EXPECT_FALSE(first.isValid());
+    EXPECT_TRUE(second.isValid());
+    EXPECT_TRUE(second.tick());
+    EXPECT_EQ(steps, 1U);
+}
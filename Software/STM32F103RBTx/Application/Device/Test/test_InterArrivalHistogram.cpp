@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+import Device.InterArrivalHistogram;
+import Driver.PulseCapture;
+
+using Device::InterArrivalHistogram;
+
+TEST(InterArrivalHistogramTest, Add_BinsIntervalsByPowerOfTwo)
+{
+    InterArrivalHistogram histogram;
+    const std::array<Driver::CaptureTick, 6U> ticks{100U, 100U, 101U, 103U, 107U, 1'107U};
+
+    histogram.add(ticks);
+
+    const auto bins = histogram.getBins();
+
+    EXPECT_EQ(histogram.getCount(), 5U);
+    EXPECT_EQ(bins[0U], 1U);  // 0
+    EXPECT_EQ(bins[1U], 1U);  // 1
+    EXPECT_EQ(bins[2U], 1U);  // 2
+    EXPECT_EQ(bins[3U], 1U);  // 4
+    EXPECT_EQ(bins[10U], 1U); // 1000 in [512, 1024)
+}
+
+TEST(InterArrivalHistogramTest, Add_KeepsIntervalAcrossCallsAndTimerWrap)
+{
+    InterArrivalHistogram histogram;
+    const std::array<Driver::CaptureTick, 1U> first{65'530U};
+    const std::array<Driver::CaptureTick, 1U> second{10U};
+
+    histogram.add(first);
+    EXPECT_EQ(histogram.getCount(), 0U);
+
+    histogram.add(second);
+
+    EXPECT_EQ(histogram.getCount(), 1U);
+    EXPECT_EQ(histogram.getBins()[5U], 1U); // 16 in [16, 32)
+}
+
+TEST(InterArrivalHistogramTest, MarkLongGap_SendsNextIntervalToOverflowBin)
+{
+    InterArrivalHistogram histogram;
+    const std::array<Driver::CaptureTick, 1U> first{10U};
+    const std::array<Driver::CaptureTick, 2U> second{12U, 13U};
+
+    histogram.markLongGap(); // Nothing to mark before the first tick.
+    histogram.add(first);
+    histogram.markLongGap();
+    histogram.add(second);
+
+    EXPECT_EQ(histogram.getBins()[InterArrivalHistogram::OVERFLOW_BIN], 1U);
+    EXPECT_EQ(histogram.getBins()[1U], 1U);
+    EXPECT_EQ(histogram.getCount(), 2U);
+}
+
+TEST(InterArrivalHistogramTest, RestartAndClear_ForgetPreviousTick)
+{
+    InterArrivalHistogram histogram;
+    const std::array<Driver::CaptureTick, 2U> ticks{0U, 8U};
+
+    histogram.add(ticks);
+    histogram.restart();
+    histogram.add(ticks);
+
+    EXPECT_EQ(histogram.getCount(), 2U);
+    EXPECT_EQ(histogram.getBins()[4U], 2U);
+
+    histogram.clear();
+    histogram.add(std::array<Driver::CaptureTick, 1U>{20U});
+
+    EXPECT_EQ(histogram.getCount(), 0U);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+
+import Device.MeasurementBatch;
+import Device.MeasurementDeviceId;
+import Device.MeasurementRecord;
+import Device.MeasurementType;
+
+namespace
+{
+    auto makeMeasurement(std::uint32_t value, std::uint16_t sequence) -> Device::MeasurementType
+    {
+        return Device::MeasurementType{
+            .source = Device::MeasurementDeviceId::PULSE_COUNTER_2,
+            .data = value,
+            .sequence = sequence,
+            .timestamp = 1'000U + value};
+    }
+}
+
+TEST(MeasurementRecordTest, ToRecord_KeepsValueAndTypeTag)
+{
+    const Device::MeasurementType narrow{
+        .source = Device::MeasurementDeviceId::DEVICE_UART_1,
+        .data = std::uint16_t{0xBEEFU},
+        .sequence = 7U,
+        .timestamp = 0x1'0000'0000U};
+
+    const Device::MeasurementRecord record = Device::toRecord(narrow);
+
+    EXPECT_EQ(record.source, Device::MeasurementDeviceId::DEVICE_UART_1);
+    EXPECT_EQ(record.type, Device::ValueType::UINT16);
+    EXPECT_EQ(record.value, 0xBEEFU);
+    EXPECT_EQ(record.sequence, 7U);
+    EXPECT_EQ(record.timestamp, 0x1'0000'0000U);
+    EXPECT_EQ(Device::getValueSize(record.type), sizeof(std::uint16_t));
+}
+
+TEST(MeasurementRecordTest, ToMeasurement_RestoresVariantAlternative)
+{
+    const Device::MeasurementType narrow{.source = Device::MeasurementDeviceId::DEVICE_UART_1,
+                                         .data = std::uint16_t{42U}};
+    const Device::MeasurementType wide = makeMeasurement(0xDEAD'BEEFU, 3U);
+
+    const Device::MeasurementType narrowBack = Device::toMeasurement(Device::toRecord(narrow));
+    const Device::MeasurementType wideBack = Device::toMeasurement(Device::toRecord(wide));
+
+    ASSERT_TRUE(std::holds_alternative<std::uint16_t>(narrowBack.data));
+    EXPECT_EQ(std::get<std::uint16_t>(narrowBack.data), 42U);
+
+    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(wideBack.data));
+    EXPECT_EQ(std::get<std::uint32_t>(wideBack.data), 0xDEAD'BEEFU);
+    EXPECT_EQ(wideBack.source, wide.source);
+    EXPECT_EQ(wideBack.sequence, wide.sequence);
+    EXPECT_EQ(wideBack.timestamp, wide.timestamp);
+}
+
+TEST(MeasurementBatchTest, Push_FillsEveryColumnInOrder)
+{
+    Device::MeasurementBatch<4U> batch;
+
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(batch.push(makeMeasurement(10U, 0U)));
+    EXPECT_TRUE(batch.push(makeMeasurement(20U, 1U)));
+    EXPECT_TRUE(batch.push(makeMeasurement(30U, 2U)));
+
+    const Device::MeasurementColumns columns = batch.getColumns();
+
+    ASSERT_EQ(columns.size(), 3U);
+    ASSERT_EQ(columns.values.size(), 3U);
+    ASSERT_EQ(columns.timestamps.size(), 3U);
+
+    for (std::size_t index = 0U; index < columns.size(); ++index)
+    {
+        EXPECT_EQ(columns.values[index], (index + 1U) * 10U);
+        EXPECT_EQ(columns.sequences[index], index);
+        EXPECT_EQ(columns.timestamps[index], 1'000U + columns.values[index]);
+        EXPECT_EQ(columns.sources[index], Device::MeasurementDeviceId::PULSE_COUNTER_2);
+        EXPECT_EQ(columns.types[index], Device::ValueType::UINT32);
+    }
+
+    const Device::MeasurementRecord second = columns.getRecord(1U);
+    EXPECT_EQ(second.value, 20U);
+    EXPECT_EQ(second.sequence, 1U);
+}
+
+TEST(MeasurementBatchTest, Push_RejectsWhenFullAndClearEmpties)
+{
+    Device::MeasurementBatch<2U> batch;
+
+    EXPECT_TRUE(batch.push(makeMeasurement(1U, 0U)));
+    EXPECT_TRUE(batch.push(makeMeasurement(2U, 1U)));
+    EXPECT_TRUE(batch.isFull());
+    EXPECT_FALSE(batch.push(makeMeasurement(3U, 2U)));
+    EXPECT_EQ(batch.getColumns().values.back(), 2U);
+
+    batch.clear();
+
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(batch.getColumns().empty());
+}
+
+TEST(MeasurementBatchTest, Of_ViewsOneRecordAsBatch)
+{
+    const Device::MeasurementRecord record = Device::toRecord(makeMeasurement(5U, 9U));
+    const Device::MeasurementColumns columns = Device::MeasurementColumns::of(record);
+
+    ASSERT_EQ(columns.size(), 1U);
+    EXPECT_EQ(columns.getRecord(0U).value, 5U);
+    EXPECT_EQ(columns.getRecord(0U).sequence, 9U);
+    EXPECT_EQ(columns.getRecord(0U).timestamp, record.timestamp);
+}
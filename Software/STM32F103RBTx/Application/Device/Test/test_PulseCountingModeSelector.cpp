@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+import Driver.PulseCountingMode;
+
+using Driver::PulseCountingMode;
+using Driver::PulseCountingModeSelector;
+
+namespace
+{
+    constexpr Driver::CycleCpu WINDOW{PulseCountingModeSelector::EVALUATION_WINDOW_CYCLES};
+
+    /// Pulses in one evaluation window at @p hertz.
+    constexpr auto pulsesPerWindow(std::uint32_t hertz) -> Driver::PulseCount
+    {
+        return static_cast<Driver::PulseCount>((static_cast<std::uint64_t>(hertz) * WINDOW) / Driver::coreHz);
+    }
+}
+
+TEST(PulseCountingModeSelectorTest, Update_EntersTimerAboveEnterThreshold)
+{
+    const Driver::PulseCount atThreshold = pulsesPerWindow(PulseCountingModeSelector::ENTER_TIMER_HZ);
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    EXPECT_EQ(selector.update(atThreshold, WINDOW, PulseCountingMode::INTERRUPT), PulseCountingMode::INTERRUPT);
+    EXPECT_EQ(selector.update(atThreshold + atThreshold + 1U, 2U * WINDOW, PulseCountingMode::INTERRUPT),
+              PulseCountingMode::TIMER);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_LeavesTimerBelowLeaveThreshold)
+{
+    const Driver::PulseCount atThreshold = pulsesPerWindow(PulseCountingModeSelector::LEAVE_TIMER_HZ);
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    EXPECT_EQ(selector.update(atThreshold, WINDOW, PulseCountingMode::TIMER), PulseCountingMode::TIMER);
+    EXPECT_EQ(selector.update(atThreshold + atThreshold - 1U, 2U * WINDOW, PulseCountingMode::TIMER),
+              PulseCountingMode::INTERRUPT);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_KeepsModeBetweenThresholds)
+{
+    // 10 kHz lies in the hysteresis gap: neither mode is left.
+    const Driver::PulseCount pulses = pulsesPerWindow(10'000U);
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    EXPECT_EQ(selector.update(pulses, WINDOW, PulseCountingMode::INTERRUPT), PulseCountingMode::INTERRUPT);
+    EXPECT_EQ(selector.update(2U * pulses, 2U * WINDOW, PulseCountingMode::TIMER), PulseCountingMode::TIMER);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_WaitsForFullEvaluationWindow)
+{
+    const Driver::PulseCount burst = 10U * pulsesPerWindow(PulseCountingModeSelector::ENTER_TIMER_HZ);
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    // Too early: no decision, and the baseline is kept for the next reading.
+    EXPECT_EQ(selector.update(burst, WINDOW - 1U, PulseCountingMode::INTERRUPT), PulseCountingMode::INTERRUPT);
+    EXPECT_EQ(selector.update(burst, WINDOW, PulseCountingMode::INTERRUPT), PulseCountingMode::TIMER);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_NormalisesLongWindowsToRate)
+{
+    // 1.5 windows' worth of pulses at 20 kHz, spread over two windows: 15 kHz.
+    const Driver::PulseCount pulses = (3U * pulsesPerWindow(PulseCountingModeSelector::ENTER_TIMER_HZ)) / 2U;
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    EXPECT_EQ(selector.update(pulses, 2U * WINDOW, PulseCountingMode::INTERRUPT), PulseCountingMode::INTERRUPT);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_HandlesCountAndCycleWrap)
+{
+    const Driver::PulseCount countStart{0xFFFF'FF00U};
+    const Driver::CycleCpu cycleStart{0xFFFF'0000U};
+    const Driver::PulseCount fast = pulsesPerWindow(PulseCountingModeSelector::ENTER_TIMER_HZ) + 1U;
+
+    PulseCountingModeSelector selector;
+    selector.reset(countStart, cycleStart);
+
+    // Both the count and the cycle counter wrap within the window.
+    EXPECT_EQ(selector.update(countStart + fast, cycleStart + WINDOW, PulseCountingMode::INTERRUPT),
+              PulseCountingMode::TIMER);
+}
+
+TEST(PulseCountingModeSelectorTest, Update_KeepsCaptureMode)
+{
+    const Driver::PulseCount burst = 10U * pulsesPerWindow(PulseCountingModeSelector::ENTER_TIMER_HZ);
+
+    PulseCountingModeSelector selector;
+    selector.reset(0U, 0U);
+
+    EXPECT_EQ(selector.update(burst, WINDOW, PulseCountingMode::CAPTURE), PulseCountingMode::CAPTURE);
+    EXPECT_EQ(selector.update(burst, 2U * WINDOW, PulseCountingMode::CAPTURE), PulseCountingMode::CAPTURE);
+}
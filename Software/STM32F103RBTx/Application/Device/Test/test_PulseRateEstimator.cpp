@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+import Device.PulseRateEstimator;
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+
+namespace
+{
+    /// Sample period of the measurement task (one 5 ms slot).
+    constexpr Driver::CycleTimestamp SAMPLE_CYCLES{(Driver::coreHz / 1'000U) * 5U};
+    constexpr std::size_t SAMPLES_PER_SECOND{200U};
+
+    constexpr auto toRate(std::uint32_t counts) -> Device::PulseRate
+    {
+        return counts << Device::RATE_FRACTION_BITS;
+    }
+
+    /// Drives an estimator like the measurement task: one sample per slot.
+    class PulseFeeder
+    {
+    public:
+        explicit PulseFeeder(Device::PulseRateEstimator &estimator, Driver::PulseCount start = 0U)
+            : estimator(estimator), count(start)
+        {
+            estimator.reset(count, now);
+        }
+
+        auto run(std::size_t samples, Driver::PulseCount pulsesPerSample) -> void
+        {
+            for (std::size_t i = 0U; i < samples; ++i)
+            {
+                now += SAMPLE_CYCLES;
+                count += pulsesPerSample;
+                estimator.update(count, now);
+            }
+        }
+
+        auto skip(Driver::CycleTimestamp cycles) -> void
+        {
+            now += cycles;
+        }
+
+    private:
+        Device::PulseRateEstimator &estimator;
+        Driver::PulseCount count;
+        Driver::CycleTimestamp now{1'000U};
+    };
+}
+
+TEST(PulseRateEstimatorTest, Rate_ZeroUntilFirstBucketCloses)
+{
+    Device::PulseRateEstimator estimator;
+    PulseFeeder feeder{estimator};
+
+    feeder.run(19U, 1U);
+    EXPECT_EQ(estimator.getCountsPerSecond(), 0U);
+
+    // The 20th sample ends the first 100 ms bucket: 20 pulses in 100 ms.
+    feeder.run(1U, 1U);
+    EXPECT_EQ(estimator.getCountsPerSecond(), toRate(200U));
+}
+
+TEST(PulseRateEstimatorTest, Rate_ConstantInputGivesSameRateInBothUnits)
+{
+    Device::PulseRateEstimator estimator;
+    PulseFeeder feeder{estimator};
+
+    // 2 pulses per 5 ms slot = 400 counts per second.
+    feeder.run(SAMPLES_PER_SECOND * 5U, 2U);
+
+    EXPECT_EQ(estimator.getCountsPerSecond(), toRate(400U));
+    EXPECT_EQ(estimator.getCountsPerMinute(), toRate(400U * 60U));
+}
+
+TEST(PulseRateEstimatorTest, Rate_WindowSlidesToNewRate)
+{
+    Device::PulseRateEstimator estimator;
+    PulseFeeder feeder{estimator};
+
+    feeder.run(SAMPLES_PER_SECOND * 2U, 2U);
+    feeder.run(SAMPLES_PER_SECOND / 2U, 0U);
+
+    // Half of the last second had no pulses.
+    EXPECT_EQ(estimator.getCountsPerSecond(), toRate(200U));
+
+    feeder.run(SAMPLES_PER_SECOND / 2U, 0U);
+    EXPECT_EQ(estimator.getCountsPerSecond(), 0U);
+}
+
+TEST(PulseRateEstimatorTest, Update_CounterWrapDoesNotDisturbRate)
+{
+    Device::PulseRateEstimator estimator;
+    PulseFeeder feeder{estimator, 0xFFFF'FFF0U};
+
+    feeder.run(SAMPLES_PER_SECOND, 3U);
+
+    EXPECT_EQ(estimator.getCountsPerSecond(), toRate(600U));
+}
+
+TEST(PulseRateEstimatorTest, Update_LongGapEmptiesWindows)
+{
+    Device::PulseRateEstimator estimator;
+    PulseFeeder feeder{estimator};
+
+    feeder.run(SAMPLES_PER_SECOND * 10U, 1U);
+    feeder.skip(SAMPLE_CYCLES * SAMPLES_PER_SECOND * 120U);
+    feeder.run(1U, 0U);
+
+    EXPECT_EQ(estimator.getCountsPerSecond(), 0U);
+    EXPECT_EQ(estimator.getCountsPerMinute(), 0U);
+}
+
+TEST(PulseRateEstimatorTest, DeadTime_CorrectsNonParalyzableLoss)
+{
+    // 1000 counts per second with 100 us dead time: busy 10 %, true rate 1111.1 per second.
+    Device::PulseRateEstimator estimator{100'000U};
+    PulseFeeder feeder{estimator};
+
+    feeder.run(SAMPLES_PER_SECOND, 5U);
+
+    const double expected = (1'000.0 / 0.9) * 256.0;
+    EXPECT_NEAR(static_cast<double>(estimator.getCountsPerSecond()), expected, 4.0);
+}
+
+TEST(PulseRateEstimatorTest, DeadTime_BusyDetectorSaturates)
+{
+    // 2000 counts per second with 500 us dead time would need a busy fraction of 100 %.
+    Device::PulseRateEstimator estimator{500'000U};
+    PulseFeeder feeder{estimator};
+
+    feeder.run(SAMPLES_PER_SECOND, 10U);
+
+    EXPECT_EQ(estimator.getCountsPerSecond(), Device::RATE_SATURATED);
+}
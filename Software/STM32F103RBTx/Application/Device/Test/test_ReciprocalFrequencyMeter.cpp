@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+import Device.ReciprocalFrequencyMeter;
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+
+using Device::Frequency;
+using Device::ReciprocalFrequencyMeter;
+
+namespace
+{
+    constexpr std::uint32_t GATE_MS{1'000U};
+    constexpr Driver::CycleTimestamp GATE{Driver::coreHz};
+    constexpr Driver::CycleTimestamp ORIGIN{5'000U};
+
+    constexpr auto toFixed(std::uint32_t hertz) -> Frequency
+    {
+        return hertz << Device::FREQUENCY_FRACTION_BITS;
+    }
+
+    constexpr auto timedEdge(Driver::PulseCount count, Driver::CycleCpu cycles) -> Driver::PulseEdge
+    {
+        return Driver::PulseEdge{.count = count, .cycles = cycles, .edgeTimed = true};
+    }
+}
+
+TEST(ReciprocalFrequencyMeterTest, ToFrequency_ResolvesFractionsOfHertz)
+{
+    // 3 periods of 1.5 s: 2/3 Hz, rounded to the nearest step.
+    const Frequency twoThirds = ReciprocalFrequencyMeter::toFrequency(3U, (Driver::coreHz / 2U) * 9U);
+
+    EXPECT_EQ(twoThirds, (toFixed(2U) + 1U) / 3U);
+    EXPECT_EQ(ReciprocalFrequencyMeter::toFrequency(50U, Driver::coreHz), toFixed(50U));
+    EXPECT_EQ(ReciprocalFrequencyMeter::toFrequency(1U, 0U), Device::FREQUENCY_SATURATED);
+    EXPECT_EQ(ReciprocalFrequencyMeter::toFrequency(70'000U, Driver::coreHz), Device::FREQUENCY_SATURATED);
+}
+
+TEST(ReciprocalFrequencyMeterTest, Update_MeasuresBetweenLastEdgesOfConsecutiveGates)
+{
+    ReciprocalFrequencyMeter meter{GATE_MS};
+    meter.reset(timedEdge(7U, 0U), ORIGIN);
+
+    EXPECT_FALSE(meter.isGateClosed(ORIGIN + GATE - 1U));
+    EXPECT_TRUE(meter.isGateClosed(ORIGIN + GATE));
+
+    // First gate only finds the edge the measurement starts from.
+    meter.update(timedEdge(10U, 1'000U), ORIGIN + GATE);
+    EXPECT_EQ(meter.getFrequency(), 0U);
+    EXPECT_FALSE(meter.isGateClosed(ORIGIN + GATE + 10U));
+
+    // 4 periods of exactly 12'345'679 cycles: 5.8320 Hz, whatever the edges' position in the gate.
+    const Driver::CycleCpu period{12'345'679U};
+    meter.update(timedEdge(14U, 1'000U + (4U * period)), ORIGIN + (2U * GATE));
+
+    EXPECT_EQ(meter.getFrequency(), ReciprocalFrequencyMeter::toFrequency(1U, period));
+    EXPECT_NEAR(static_cast<double>(meter.getFrequency()) / toFixed(1U), 72e6 / period, 1e-4);
+}
+
+TEST(ReciprocalFrequencyMeterTest, Update_SpansCycleCounterWrap)
+{
+    ReciprocalFrequencyMeter meter{GATE_MS};
+    meter.reset(timedEdge(0U, 0U), ORIGIN);
+
+    meter.update(timedEdge(1U, 0xFFFF'FF00U), ORIGIN + GATE);
+    meter.update(timedEdge(2U, 0xFFFF'FF00U + static_cast<Driver::CycleCpu>(Driver::coreHz / 4U)), ORIGIN + (2U * GATE));
+
+    EXPECT_EQ(meter.getFrequency(), toFixed(4U));
+}
+
+TEST(ReciprocalFrequencyMeterTest, Update_MeasuresAcrossEmptyGates)
+{
+    ReciprocalFrequencyMeter meter{GATE_MS};
+    meter.reset(timedEdge(0U, 0U), ORIGIN);
+
+    meter.update(timedEdge(2U, 100U), ORIGIN + GATE);
+    meter.update(timedEdge(4U, 100U + static_cast<Driver::CycleCpu>(Driver::coreHz)), ORIGIN + (2U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+
+    // A gate without edges keeps the value and the reference.
+    meter.update(timedEdge(4U, 100U + static_cast<Driver::CycleCpu>(Driver::coreHz)), ORIGIN + (3U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+
+    // One period of 2.5 s, measured over three gates: 0.4 Hz.
+    const Driver::CycleCpu period{(Driver::coreHz / 2U) * 5U};
+    meter.update(timedEdge(5U, 100U + static_cast<Driver::CycleCpu>(Driver::coreHz) + period), ORIGIN + (4U * GATE));
+    EXPECT_EQ(meter.getFrequency(), ReciprocalFrequencyMeter::toFrequency(1U, period));
+}
+
+TEST(ReciprocalFrequencyMeterTest, Update_ReadsZeroAfterMaxGateWithoutEdgesAndRestarts)
+{
+    constexpr std::uint32_t TIMEOUT_GATES{ReciprocalFrequencyMeter::MAX_GATE_MS / GATE_MS};
+    const Driver::PulseEdge lastEdge = timedEdge(4U, 100U + static_cast<Driver::CycleCpu>(Driver::coreHz));
+
+    ReciprocalFrequencyMeter meter{GATE_MS};
+    meter.reset(timedEdge(0U, 0U), ORIGIN);
+
+    meter.update(timedEdge(2U, 100U), ORIGIN + GATE);
+    meter.update(lastEdge, ORIGIN + (2U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+
+    for (std::uint32_t gate = 1U; gate < TIMEOUT_GATES; ++gate)
+    {
+        meter.update(lastEdge, ORIGIN + ((2U + gate) * GATE));
+        EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+    }
+
+    meter.update(lastEdge, ORIGIN + ((2U + TIMEOUT_GATES) * GATE));
+    EXPECT_EQ(meter.getFrequency(), 0U);
+
+    // The edge ending the idle time only starts the next measurement.
+    meter.update(timedEdge(5U, 10U), ORIGIN + ((3U + TIMEOUT_GATES) * GATE));
+    EXPECT_EQ(meter.getFrequency(), 0U);
+
+    meter.update(timedEdge(8U, 10U + static_cast<Driver::CycleCpu>(Driver::coreHz / 2U)),
+                 ORIGIN + ((4U + TIMEOUT_GATES) * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(6U));
+}
+
+TEST(ReciprocalFrequencyMeterTest, Update_RestartsWhenTimingChangesAndSkipsMissedGates)
+{
+    ReciprocalFrequencyMeter meter{GATE_MS};
+    meter.reset(timedEdge(0U, 0U), ORIGIN);
+
+    meter.update(timedEdge(1U, 0U), ORIGIN + GATE);
+    meter.update(timedEdge(3U, static_cast<Driver::CycleCpu>(Driver::coreHz)), ORIGIN + (2U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+
+    // Untimed counts come from another counter: the value is kept and the measurement restarts.
+    meter.update(Driver::PulseEdge{.count = 900U, .cycles = 0U}, ORIGIN + (3U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(2U));
+
+    meter.update(Driver::PulseEdge{.count = 1'000U, .cycles = 0U}, ORIGIN + (4U * GATE));
+    meter.update(Driver::PulseEdge{.count = 1'300U, .cycles = static_cast<Driver::CycleCpu>(Driver::coreHz)},
+                 ORIGIN + (10U * GATE));
+    EXPECT_EQ(meter.getFrequency(), toFixed(300U));
+
+    // The late update opened a full gate from its own time.
+    EXPECT_FALSE(meter.isGateClosed(ORIGIN + (11U * GATE) - 1U));
+    EXPECT_TRUE(meter.isGateClosed(ORIGIN + (11U * GATE)));
+}
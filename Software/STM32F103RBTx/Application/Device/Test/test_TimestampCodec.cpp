@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+import Device.TimestampCodec;
+import Driver.CycleCpu;
+import Driver.CycleExtender;
+
+// ==================== Cycle Extender Tests ====================
+
+TEST(CycleExtenderTest, Extend_AcrossCounterWrap_StaysMonotonic)
+{
+    Driver::CycleExtender extender;
+    extender.reset(0xFFFF'FF00U);
+
+    EXPECT_EQ(extender.extend(0xFFFF'FFF0U), 0xF0U);
+    EXPECT_EQ(extender.extend(0x0000'0010U), 0x110U);
+    EXPECT_EQ(extender.extend(0x8000'0000U), 0x8000'0100ULL);
+    EXPECT_EQ(extender.extend(0x0000'0000U), 0x1'0000'0100ULL);
+}
+
+// ==================== Timestamp Encoder Tests ====================
+
+TEST(TimestampCodecTest, Encode_FirstAbsoluteThenDeltas)
+{
+    Device::TimestampEncoder encoder;
+
+    const Device::TimestampCode first = encoder.encode(1'000U);
+    const Device::TimestampCode second = encoder.encode(1'250U);
+
+    EXPECT_TRUE(Device::isAbsolute(first));
+    EXPECT_EQ(Device::getCodeValue(first), 1'000U);
+    EXPECT_FALSE(Device::isAbsolute(second));
+    EXPECT_EQ(Device::getCodeValue(second), 250U);
+
+    encoder.reset();
+    EXPECT_TRUE(Device::isAbsolute(encoder.encode(1'300U)));
+}
+
+TEST(TimestampCodecTest, Encode_OlderTimestamp_WrittenAbsolute)
+{
+    Device::TimestampEncoder encoder;
+
+    static_cast<void>(encoder.encode(500U));
+    const Device::TimestampCode code = encoder.encode(400U);
+
+    EXPECT_TRUE(Device::isAbsolute(code));
+    EXPECT_EQ(Device::getCodeValue(code), 400U);
+}
+
+TEST(TimestampCodecTest, Decode_RoundTrip)
+{
+    constexpr std::array<Driver::CycleTimestamp, 4U> TIMESTAMPS{
+        72'000'000ULL * 3'600ULL, (72'000'000ULL * 3'600ULL) + 17U, (72'000'000ULL * 3'600ULL) + 360'017U, 5U};
+
+    Device::TimestampEncoder encoder;
+    Device::TimestampDecoder decoder;
+
+    for (const Driver::CycleTimestamp timestamp : TIMESTAMPS)
+    {
+        Driver::CycleTimestamp decoded{0U};
+
+        ASSERT_TRUE(decoder.decode(encoder.encode(timestamp), decoded));
+        EXPECT_EQ(decoded, timestamp);
+    }
+}
+
+TEST(TimestampCodecTest, Decode_DeltaWithoutReference_Rejected)
+{
+    Device::TimestampDecoder decoder;
+    Driver::CycleTimestamp decoded{0U};
+
+    EXPECT_FALSE(decoder.decode(Device::TimestampCode{10U}, decoded));
+}
+
+// ==================== Varint Tests ====================
+
+TEST(VarintCodecTest, EncodeDecode_RoundTrip)
+{
+    constexpr std::array<std::uint64_t, 5U> VALUES{0U, 127U, 128U, 720'000U, UINT64_MAX};
+
+    for (const std::uint64_t value : VALUES)
+    {
+        std::array<std::uint8_t, Device::VarintCodec::MAX_SIZE> buffer{};
+
+        const std::size_t size = Device::VarintCodec::encode(value, buffer);
+        ASSERT_NE(size, 0U);
+        EXPECT_EQ(size, Device::VarintCodec::getSize(value));
+
+        std::uint64_t decoded{0U};
+        EXPECT_EQ(Device::VarintCodec::decode(std::span{buffer}.first(size), decoded), size);
+        EXPECT_EQ(decoded, value);
+    }
+}
+
+TEST(VarintCodecTest, SlotDelta_FitsInThreeBytes)
+{
+    // One 5 ms slot at 72 MHz as a delta code.
+    constexpr std::uint64_t SLOT_DELTA_CODE{360'000ULL << 1U};
+
+    EXPECT_EQ(Device::VarintCodec::getSize(SLOT_DELTA_CODE), 3U);
+}
+
+TEST(VarintCodecTest, Encode_BufferTooSmall_ReturnsZero)
+{
+    std::array<std::uint8_t, 1U> buffer{};
+
+    EXPECT_EQ(Device::VarintCodec::encode(128U, buffer), 0U);
+}
+
+TEST(VarintCodecTest, Decode_Truncated_ReturnsZero)
+{
+    constexpr std::array<std::uint8_t, 2U> TRUNCATED{0x80U, 0x80U};
+    std::uint64_t decoded{0U};
+
+    EXPECT_EQ(Device::VarintCodec::decode(TRUNCATED, decoded), 0U);
+}
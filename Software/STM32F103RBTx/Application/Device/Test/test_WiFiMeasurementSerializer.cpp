@@ -1,8 +1,3 @@
-#include "Device/Inc/WiFiSerializer.hpp"
-#include "Device/Inc/MeasurementType.hpp"
-#include "Device/Inc/MeasurementDeviceId.hpp"
-#include "Device/Inc/Crc32.hpp"
-
 #include <gtest/gtest.h>
 #include <array>
 #include <cstdint>
@@ -11,6 +6,12 @@
 #include <span>
 #include <expected>
 
+import Device.Crc32;
+import Device.MeasurementDeviceId;
+import Device.MeasurementType;
+import Device.TimestampCodec;
+import Device.WiFiSerializer;
+
 // --- Test Fixture ---
 
 class WiFiSerializerTest : public ::testing::Test
@@ -19,13 +20,20 @@ protected:
     // Protocol Constants
     static constexpr std::size_t FIELD_LENGTH_SIZE = 2U;
     static constexpr std::size_t FIELD_SOURCE_SIZE = 1U;
+    static constexpr std::size_t FIELD_SEQUENCE_SIZE = 2U;
     static constexpr std::size_t FIELD_CRC_SIZE = 4U;
-    static constexpr std::size_t PROTOCOL_OVERHEAD = FIELD_LENGTH_SIZE + FIELD_SOURCE_SIZE + FIELD_CRC_SIZE;
+    static constexpr std::size_t PROTOCOL_OVERHEAD =
+        FIELD_LENGTH_SIZE + FIELD_SOURCE_SIZE + FIELD_SEQUENCE_SIZE + FIELD_CRC_SIZE;
+
+    // Varint size of the absolute code of timestamp 0 (the default of MeasurementType)
+    static constexpr std::size_t ZERO_TIMESTAMP_SIZE = 1U;
+    static constexpr std::uint8_t ZERO_TIMESTAMP_CODE = 0x01U;
 
     // Offset Constants
     static constexpr std::size_t OFFSET_LENGTH = 0U;
     static constexpr std::size_t OFFSET_SOURCE = FIELD_LENGTH_SIZE;
-    static constexpr std::size_t OFFSET_DATA = FIELD_LENGTH_SIZE + FIELD_SOURCE_SIZE;
+    static constexpr std::size_t OFFSET_SEQUENCE = OFFSET_SOURCE + FIELD_SOURCE_SIZE;
+    static constexpr std::size_t OFFSET_DATA = OFFSET_SEQUENCE + FIELD_SEQUENCE_SIZE;
 
     // Bit manipulation constants
     static constexpr std::uint8_t BITS_PER_BYTE = 8U;
@@ -101,7 +109,7 @@ protected:
 TEST_F(WiFiSerializerTest, SerializesUint8Measurement)
 {
     constexpr std::uint16_t TEST_VALUE = 0xABU;
-    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint16_t);
+    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint16_t) + ZERO_TIMESTAMP_SIZE;
 
     const auto measurement = Device::MeasurementType{
         .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
@@ -116,13 +124,14 @@ TEST_F(WiFiSerializerTest, SerializesUint8Measurement)
     EXPECT_EQ(buffer[OFFSET_SOURCE], static_cast<std::uint8_t>(Device::MeasurementDeviceId::PULSE_COUNTER_1));
     EXPECT_EQ(buffer[OFFSET_DATA], static_cast<std::uint8_t>(TEST_VALUE & 0xFF));
     EXPECT_EQ(buffer[OFFSET_DATA + 1], static_cast<std::uint8_t>((TEST_VALUE >> 8) & 0xFF));
+    EXPECT_EQ(buffer[OFFSET_DATA + sizeof(std::uint16_t)], ZERO_TIMESTAMP_CODE);
 }
 
 // Test 2: Serialize uint16_t (Little Endian)
 TEST_F(WiFiSerializerTest, SerializesUint16Measurement)
 {
     constexpr std::uint16_t TEST_VALUE = 0x1234U;
-    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint16_t);
+    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint16_t) + ZERO_TIMESTAMP_SIZE;
 
     const auto measurement = Device::MeasurementType{
         .source = Device::MeasurementDeviceId::PULSE_COUNTER_2,
@@ -144,7 +153,7 @@ TEST_F(WiFiSerializerTest, SerializesUint16Measurement)
 TEST_F(WiFiSerializerTest, SerializesUint32Measurement)
 {
     constexpr std::uint32_t TEST_VALUE = 0xAABBCCDDU;
-    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint32_t);
+    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint32_t) + ZERO_TIMESTAMP_SIZE;
 
     const auto measurement = Device::MeasurementType{
         .source = Device::MeasurementDeviceId::PULSE_COUNTER_3,
@@ -266,11 +275,14 @@ TEST_F(WiFiSerializerTest, SerializesMaximumValue)
 TEST_F(WiFiSerializerTest, VerifiesCompleteProtocolFormat)
 {
     constexpr std::uint32_t TEST_VALUE = 0x12345678U;
-    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint32_t);
+    constexpr std::uint16_t TEST_SEQUENCE = 0x0102U;
+    constexpr std::size_t EXPECTED_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint32_t) + ZERO_TIMESTAMP_SIZE;
 
     const auto measurement = Device::MeasurementType{
         .source = Device::MeasurementDeviceId::PULSE_COUNTER_4,
-        .data = TEST_VALUE};
+        .data = TEST_VALUE,
+        .sequence = TEST_SEQUENCE,
+        .timestamp = 5U};
 
     const auto result = Device::WiFiSerializer::serialize(measurement, buffer);
 
@@ -281,13 +293,16 @@ TEST_F(WiFiSerializerTest, VerifiesCompleteProtocolFormat)
     EXPECT_EQ(buffer[1], static_cast<std::uint8_t>((EXPECTED_SIZE >> 8) & 0xFF));
     EXPECT_EQ(extractLength(), EXPECTED_SIZE);
     EXPECT_EQ(buffer[2], static_cast<std::uint8_t>(Device::MeasurementDeviceId::PULSE_COUNTER_4));
-    EXPECT_EQ(buffer[3], 0x78U); // LSB
-    EXPECT_EQ(buffer[4], 0x56U);
-    EXPECT_EQ(buffer[5], 0x34U);
-    EXPECT_EQ(buffer[6], 0x12U); // MSB
+    EXPECT_EQ(buffer[3], 0x02U); // Sequence LSB
+    EXPECT_EQ(buffer[4], 0x01U); // Sequence MSB
+    EXPECT_EQ(buffer[5], 0x78U); // Value LSB
+    EXPECT_EQ(buffer[6], 0x56U);
+    EXPECT_EQ(buffer[7], 0x34U);
+    EXPECT_EQ(buffer[8], 0x12U); // Value MSB
+    EXPECT_EQ(buffer[9], 0x0BU); // Absolute timestamp 5: (5 << 1) | 1
 
     const auto crcOffset = msgLength - FIELD_CRC_SIZE;
-    EXPECT_EQ(crcOffset, 7U);
+    EXPECT_EQ(crcOffset, 10U);
 
     const auto storedCRC = extractCRC(crcOffset);
     const auto dataSpan = std::span{buffer}.subspan(0, crcOffset);
@@ -318,4 +333,68 @@ TEST_F(WiFiSerializerTest, HandlesAllSourceIds)
         ASSERT_TRUE(result.has_value()) << "Failed for source ID: " << static_cast<int>(sourceId);
         EXPECT_EQ(testBuffer[OFFSET_SOURCE], static_cast<std::uint8_t>(sourceId));
     }
-}
\ No newline at end of file
+}
+
+// Test 11: Sequence number (Little Endian)
+TEST_F(WiFiSerializerTest, SerializesSequenceNumber)
+{
+    constexpr std::uint16_t TEST_SEQUENCE = 0xBEEFU;
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint16_t{TEST_DATA_BYTE},
+        .sequence = TEST_SEQUENCE};
+
+    const auto result = Device::WiFiSerializer::serialize(measurement, buffer);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(extractLittleEndian<std::uint16_t>(OFFSET_SEQUENCE), TEST_SEQUENCE);
+}
+
+// Test 12: Timestamp code as varint, absolute or delta
+TEST_F(WiFiSerializerTest, SerializesTimestampCodeAsVarint)
+{
+    constexpr std::uint64_t TIMESTAMP = 360'000U;
+    constexpr std::uint64_t DELTA = 100U;
+    constexpr std::size_t OFFSET_TIMESTAMP = OFFSET_DATA + sizeof(std::uint32_t);
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_2,
+        .data = std::uint32_t{TEST_DATA_BYTE},
+        .timestamp = TIMESTAMP};
+
+    Device::TimestampEncoder encoder{};
+    const Device::TimestampCode absolute = encoder.encode(TIMESTAMP);
+    const Device::TimestampCode delta = encoder.encode(TIMESTAMP + DELTA);
+    std::uint64_t decoded{};
+
+    const auto absoluteResult = Device::WiFiSerializer::serialize(measurement, absolute, buffer);
+
+    ASSERT_TRUE(absoluteResult.has_value());
+    EXPECT_EQ(absoluteResult.value(), PROTOCOL_OVERHEAD + sizeof(std::uint32_t) + 3U);
+    ASSERT_EQ(Device::VarintCodec::decode(std::span{buffer}.subspan(OFFSET_TIMESTAMP), decoded), 3U);
+    EXPECT_TRUE(Device::isAbsolute(decoded));
+    EXPECT_EQ(Device::getCodeValue(decoded), TIMESTAMP);
+
+    const auto deltaResult = Device::WiFiSerializer::serialize(measurement, delta, buffer);
+
+    ASSERT_TRUE(deltaResult.has_value());
+    EXPECT_EQ(deltaResult.value(), PROTOCOL_OVERHEAD + sizeof(std::uint32_t) + 2U);
+    ASSERT_EQ(Device::VarintCodec::decode(std::span{buffer}.subspan(OFFSET_TIMESTAMP), decoded), 2U);
+    EXPECT_FALSE(Device::isAbsolute(decoded));
+    EXPECT_EQ(Device::getCodeValue(decoded), DELTA);
+}
+
+// Test 13: Buffer one byte short of the frame
+TEST_F(WiFiSerializerTest, HandlesBufferOneByteShort)
+{
+    constexpr std::size_t FRAME_SIZE = PROTOCOL_OVERHEAD + sizeof(std::uint32_t) + ZERO_TIMESTAMP_SIZE;
+
+    const auto measurement = Device::MeasurementType{
+        .source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+        .data = std::uint32_t{TEST_DATA_BYTE}};
+
+    const auto result = Device::WiFiSerializer::serialize(measurement, std::span{buffer}.first(FRAME_SIZE - 1U));
+
+    EXPECT_FALSE(result.has_value());
+}
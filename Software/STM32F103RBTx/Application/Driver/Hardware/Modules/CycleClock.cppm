@@ -9,6 +9,7 @@ module;
 export module Driver.CycleClock;
 
 import Driver.CycleCpu;
+import Driver.CycleExtender;
 
 export namespace Driver
 {
@@ -68,6 +69,7 @@ export namespace Driver
             CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
             DWT->CYCCNT = 0U;
             DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+            extender.reset();
         }
 
         /**
@@ -81,6 +83,19 @@ export namespace Driver
             return static_cast<CycleCpu>(counter);
         }
 
+        /**
+         * @brief Read the cycle counter extended to 64 bits.
+         *
+         * @details
+         * Main loop only; must be called at least once per counter wrap (see CycleExtender).
+         *
+         * @return Cycles since init().
+         */
+        [[nodiscard]] static auto timestamp() noexcept -> CycleTimestamp
+        {
+            return extender.extend(now());
+        }
+
         /**
          * @brief Compute elapsed cycles between two readings.
          *
@@ -95,5 +110,8 @@ export namespace Driver
             const CycleCpu result = end - start;
             return result;
         }
+
+    private:
+        inline static CycleExtender extender{};
     };
 } // namespace Driver
\ No newline at end of file
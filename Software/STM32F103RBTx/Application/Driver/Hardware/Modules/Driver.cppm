@@ -8,7 +8,9 @@ export import Driver.UartStatus;
 export import Driver.SdCardStatus;
 export import Driver.FileOpenMode;
 export import Driver.PulseCounterId;
+export import Driver.PulseCapture;
 export import Driver.PulseCount;
+export import Driver.PulseCountingMode;
 export import Driver.DriverComponent;
 
 export import Driver.CycleClock;
@@ -1,32 +1,63 @@
 module;
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <utility>
 
 export module Driver.PulseCounterDriver;
 
 import Driver.DriverComponent;
+import Driver.PulseCapture;
 import Driver.PulseCounterDriverConcept;
 import Driver.PulseCounterId;
 import Driver.PulseCount;
+import Driver.PulseCountingMode;
 
 export namespace Driver
 {
     /**
      * @class PulseCounterDriver
-     * @brief Hardware abstraction layer for external pulse counting via GPIO interrupts.
+     * @brief Hardware abstraction layer for external pulse counting via GPIO interrupts
+     *        or a hardware timer.
      *
      * This driver provides access to hardware pulse counters connected to BNC connectors.
-     * Each instance references a shared counter that is incremented atomically from
-     * interrupt context (EXTI handler).
+     * The EXTI handler increments a shared per-connector counter. The main loop takes and
+     * zeroes it in one LDREX/STREX exchange on each read and adds it to a 64-bit total, so
+     * no pulse is lost between reading and clearing, and the total does not wrap.
+     *
+     * Above a few hundred kHz one interrupt per pulse would take the whole CPU. read()
+     * therefore watches the pulse rate (see PulseCountingModeSelector) and, when it is high,
+     * masks the EXTI line and lets the input clock TIM4 in external clock mode 1 instead,
+     * so pulses are counted with no interrupt load. When the rate drops, counting returns
+     * to EXTI. The count read() returns continues across both switches.
+     *
+     * @note Only bncA (PB6, TIM4 TI1) and bncB (PB7, TIM4 TI2) reach the timer trigger
+     *       input; PB6..PB9 have no ETR pin. TIM4 counts one input at a time, taken by the
+     *       first of them to need it. bncC and bncD always count with EXTI.
+     * @note A handful of pulses may be lost while a switch is in progress.
+     *
+     * With startGatedSampling() the four counters are not read live any more: the TIM1
+     * update interrupt latches all of them at once every gate period, and every read
+     * returns the counts of the latest gate. Values of different connectors read after the
+     * same gate therefore describe the same instant.
+     *
+     * startCapture() puts one connector in CAPTURE mode: TIM4 runs from the core clock and
+     * every rising edge latches its count into a capture channel, which DMA copies into a
+     * ring of CAPTURE_CAPACITY ticks. There is one interrupt per pass over the ring and none
+     * per pulse, so 100 k pulses/s and more are timestamped with little CPU load. The
+     * connector keeps counting (one tick per pulse), and readCaptures() drains the ticks.
+     * Capture takes TIM4, so no connector uses TIMER mode meanwhile.
+     *
+     * In INTERRUPT mode the EXTI handler also stores the cycle counter at every edge, and
+     * readLastEdge() returns it with a free-running edge count, for reciprocal frequency
+     * measurement.
      *
-     * @note Thread-safe: Counter increments are atomic (single instruction on Cortex-M).
      * @note Debouncing is done in hardware.
      * @note The counter is never reset automatically - client code must call clear().
      * @note Multiple instances can reference the same counter if needed.
      *
-     * @warning Reading the counter on platforms without atomic 32-bit loads may require
-     *          disabling interrupts briefly to ensure consistency.
+     * @note All reads and clear() must come from the main loop.
      */
     class PulseCounterDriver final : public DriverComponent
     {
@@ -47,18 +78,92 @@ export namespace Driver
 
         /**
          * @brief Reads the current pulse count.
-         * @return Current accumulated pulse count since last clear().
-         * @note This is a non-blocking read of a shared volatile counter.
-         * @note On STM32F1 (Cortex-M3), 32-bit reads are atomic.
+         * @return Current accumulated pulse count since last clear(), modulo 2^32.
+         * @note Also switches the counting mode when the pulse rate calls for it, so it
+         *       must be called from the main loop, regularly (every measurement slot).
          */
         [[nodiscard]] auto read() const noexcept -> PulseCount;
 
         /**
-         * @brief Resets the pulse counter to zero.
-         * @note This does not disable interrupts - new pulses may arrive immediately.
+         * @brief Reads the current pulse count with the instant it was counted at.
+         * @note Same rules as read(); with gated sampling the count of the latest gate.
+         */
+        [[nodiscard]] auto readSample() const noexcept -> PulseSample;
+
+        /**
+         * @brief Returns the number of the latest gate; 0 without gated sampling.
+         * @note Does not read the counter, so it is cheap enough to poll.
+         */
+        [[nodiscard]] auto getGate() const noexcept -> std::uint32_t;
+
+        /**
+         * @brief Returns the edge count and the cycle counter at the latest edge.
+         *
+         * @details
+         * Edges are timed only in INTERRUPT mode, to the cycle plus the EXTI interrupt latency.
+         * EXTI9_5 has priority 0 like TIM2, USB, DMA1 channel 1, TIM1 and TIM4, so an edge during
+         * one of their handlers, or while interrupts are masked, is stamped only once it ends.
+         * In TIMER and CAPTURE modes there is no per-edge interrupt; the result then holds the
+         * count and time of readSample() and edgeTimed is false. The count of timed and untimed
+         * results must not be compared with each other.
+         *
+         * @note Same rules as read().
+         */
+        [[nodiscard]] auto readLastEdge() const noexcept -> PulseEdge;
+
+        /**
+         * @brief Returns how the input is counted at the moment.
+         */
+        [[nodiscard]] auto getCountingMode() const noexcept -> PulseCountingMode;
+
+        /**
+         * @brief Returns the pulses since the previous readInterval() or clear().
+         *
+         * @details
+         * Exact at any rate, as long as fewer than 2^32 pulses arrive between two calls.
+         * The interval is tracked per connector, so it suits a single consumer; other
+         * consumers should take differences of read() or readTotal().
+         */
+        [[nodiscard]] auto readInterval() noexcept -> PulseCount;
+
+        /**
+         * @brief Returns all pulses since the last clear(), without wrap.
+         */
+        [[nodiscard]] auto readTotal() const noexcept -> PulseCountTotal;
+
+        /**
+         * @brief Resets the pulse counter, the total and the interval to zero.
+         * @note Pulses arriving during the call are kept and counted after the clear.
          */
         auto clear() noexcept -> void;
 
+        /**
+         * @brief Timestamps every pulse of this connector from now on.
+         * @param tickHz Capture timer rate; see isCaptureTickHzValid().
+         * @return false if this connector cannot be captured (only bncB and bncC can), the
+         *         rate is invalid, or a connector is already captured.
+         * @note Takes TIM4 from a connector in TIMER mode; that one continues with EXTI.
+         */
+        [[nodiscard]] auto startCapture(std::uint32_t tickHz) noexcept -> bool;
+
+        /**
+         * @brief Returns this connector to EXTI counting; ticks not read are discarded.
+         */
+        auto stopCapture() noexcept -> void;
+
+        /**
+         * @brief Moves the oldest unread capture ticks into @p destination.
+         * @return Number of ticks written; 0 if this connector is not captured.
+         * @note Must be called before the DMA laps the reader, i.e. at least once per
+         *       CAPTURE_CAPACITY pulses; ticks overwritten before are counted as lost.
+         */
+        [[nodiscard]] auto readCaptures(std::span<CaptureTick> destination) noexcept -> std::size_t;
+
+        /**
+         * @brief Returns the ticks overwritten before they were read since startCapture().
+         */
+        [[nodiscard]] auto getLostCaptures() const noexcept -> std::uint32_t;
+
         /**
          * @brief Starts pulse counting by clearing the counter.
          * @return Always returns true (API constraints).
@@ -66,12 +171,22 @@ export namespace Driver
          */
         [[nodiscard]] auto onStart() noexcept -> bool;
 
-    private:
         /**
-         * @brief Reference to the shared hardware counter for this device.
-         * @note Modified from ISR context - ensure atomic access patterns.
+         * @brief Latches all four counters together every @p periodMs from now on.
+         * @param periodMs Gate period, 1 to 6553 ms.
+         * @return false if the period is out of range.
+         * @note Takes TIM1. Calling it again while gated sampling runs keeps the first period.
          */
-        PulseCount &counter;
+        [[nodiscard]] static auto startGatedSampling(std::uint32_t periodMs) noexcept -> bool;
+
+        /**
+         * @brief Returns to live reads of the counters.
+         */
+        static auto stopGatedSampling() noexcept -> void;
+
+    private:
+        /// Connector this instance counts; selects its counting state.
+        PulseCounterId deviceId;
     };
 
     static_assert(Concepts::PulseCounterDriverConcept<PulseCounterDriver>,
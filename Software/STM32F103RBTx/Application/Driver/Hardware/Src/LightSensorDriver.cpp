@@ -9,6 +9,16 @@ module;
 
 module Driver.LightSensorDriver;
 
+import Driver.IsrEvent;
+
+// Global HAL ADC conversion-complete callback. With DMA enabled it runs from the DMA
+// transfer-complete interrupt once adcDmaBuffer has been filled.
+extern "C" void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    static_cast<void>(hadc);
+    Driver::IsrEventNotifier::notify(Driver::IsrEvent::LIGHT_SENSOR_DMA_COMPLETE);
+}
+
 namespace Driver
 {
     auto LightSensorDriver::onStart() noexcept -> bool
@@ -1,16 +1,25 @@
 module;
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <utility>
 
+#include "stm32f1xx_hal.h"
 #include "stm32f1xx_hal_gpio.h"
+#include "stm32f1xx_hal_tim.h"
 
 module Driver.PulseCounterDriver;
 
+import Driver.CoreClockConfig;
+import Driver.CycleClock;
+import Driver.PulseCapture;
 import Driver.PulseCounterId;
+import Driver.PulseCountingMode;
 
 namespace
 {
@@ -19,8 +28,588 @@ namespace
 
     // Modified in interruption, shared by all instances of PulseCounterDriver
     // Each counter uses one and only one element in array.
-    alignas(std::uint32_t) std::array<Driver::PulseCount,
-                                      PULSE_COUNTER_COUNT> rawPulseCounters = {0};
+    // Holds only the pulses since the last harvest; accumulate() moves them into
+    // CountingState::running with an atomic exchange.
+    alignas(std::atomic_ref<Driver::PulseCount>::required_alignment)
+        std::array<Driver::PulseCount, PULSE_COUNTER_COUNT> rawPulseCounters = {0};
+
+    static_assert(std::atomic_ref<Driver::PulseCount>::is_always_lock_free,
+                  "Harvesting the EXTI counters relies on LDREX/STREX, not on a lock");
+
+    /**
+     * @brief Latest EXTI edge of one connector.
+     *
+     * Written by the EXTI interrupt only. count is free-running and not affected by clear(),
+     * so the main loop detects an edge that arrived during its read by a change of count.
+     */
+    struct EdgeStamp final
+    {
+        Driver::PulseCount count{0U};
+        Driver::CycleCpu cycles{0U};
+    };
+
+    std::array<EdgeStamp, PULSE_COUNTER_COUNT> edgeStamps{};
+
+    /**
+     * @brief Counting state of one connector.
+     *
+     * mode, timerMark and running are harvested by the gate interrupt while gated sampling
+     * runs and by the main loop otherwise; the main loop changes them only with the gate
+     * interrupt masked (see GateLock). The other fields are main loop only.
+     */
+    struct CountingState final
+    {
+        Driver::PulseCountingMode mode{Driver::PulseCountingMode::INTERRUPT};
+
+        /// Timer reading at the previous harvest (TIMER mode).
+        Driver::PulseCount timerMark{0U};
+
+        /// Free-running count of all harvested pulses, modulo 2^32.
+        Driver::PulseCount running{0U};
+
+        /// running (or its gate snapshot) when total was last updated.
+        Driver::PulseCount totalMark{0U};
+
+        /// Pulses since the last clear(); 64 bits do not wrap within the life of the device.
+        Driver::PulseCountTotal total{0U};
+
+        /// total at the previous readInterval() or clear().
+        Driver::PulseCountTotal intervalMark{0U};
+
+        Driver::PulseCountingModeSelector selector{};
+
+        /// Cycle counter at the instant total was counted, and its gate (0: not gated).
+        Driver::CycleCpu sampleCycles{0U};
+        std::uint32_t sampleGate{0U};
+    };
+
+    std::array<CountingState, PULSE_COUNTER_COUNT> countingStates{};
+
+    /**
+     * @brief Counts of all connectors latched by one gate.
+     *
+     * @details
+     * Written by the gate interrupt between two increments of sequence, so an odd sequence
+     * means a write in progress; readers retry until they see the same even value before
+     * and after their copy (a sequence lock).
+     */
+    struct GateSnapshot final
+    {
+        std::array<Driver::PulseCount, PULSE_COUNTER_COUNT> counts{};
+        Driver::CycleCpu cycles{0U};
+        std::atomic<std::uint32_t> sequence{0U};
+    };
+
+    GateSnapshot gateSnapshot{};
+
+    /// Gated sampling runs; main loop only.
+    bool gateEnabled{false};
+
+    /// TIM1 runs at 10 kHz, so one count is 0.1 ms.
+    constexpr std::uint32_t GATE_TIMER_PRESCALER{(Driver::coreHz / 10'000U) - 1U};
+    constexpr std::uint32_t GATE_TICKS_PER_MS{10U};
+    constexpr std::uint32_t GATE_MAX_PERIOD_MS{0x1'0000U / GATE_TICKS_PER_MS};
+
+    /// EXTI line of each connector; line n is GPIO_PIN_n.
+    constexpr std::array<std::uint16_t, PULSE_COUNTER_COUNT> EXTI_PINS{
+        GPIO_PIN_6,
+        GPIO_PIN_7,
+        GPIO_PIN_8,
+        GPIO_PIN_9};
+
+    /// TIM4 trigger input of each connector; 0 if the pin cannot clock the timer.
+    constexpr std::array<std::uint32_t, PULSE_COUNTER_COUNT> TIMER_TRIGGERS{
+        TIM_TS_TI1FP1,
+        TIM_TS_TI2FP2,
+        0U,
+        0U};
+
+    /// TIM4 input capture selection mapping the trigger channel onto its own pin.
+    constexpr std::array<std::uint32_t, PULSE_COUNTER_COUNT> TIMER_INPUT_SELECTION{
+        TIM_CCMR1_CC1S_0,
+        TIM_CCMR1_CC2S_0,
+        0U,
+        0U};
+
+    constexpr std::uint8_t NO_TIMER_OWNER{PULSE_COUNTER_COUNT};
+    constexpr std::uint32_t TIMER_PERIOD{0xFFFFU};
+    constexpr std::uint16_t TIMER_HALF_PERIOD{0x8000U};
+    constexpr std::uint8_t TIMER_BITS{16U};
+
+    /// Connector whose input clocks TIM4, or NO_TIMER_OWNER.
+    std::uint8_t timerOwner{NO_TIMER_OWNER};
+
+    /// Upper 16 bits of the TIM4 count; incremented in TIM4_IRQHandler.
+    volatile std::uint16_t timerOverflows{0U};
+
+    /**
+     * @brief Lets the pin of @p index clock TIM4 (external clock mode 1, rising edge).
+     */
+    auto startTimer(std::uint8_t index) noexcept -> void
+    {
+        __HAL_RCC_TIM4_CLK_ENABLE();
+
+        TIM4->CR1 = 0U;
+        TIM4->DIER = 0U;
+
+        // Inputs are debounced in hardware: no input filter, rising edge like the EXTI lines.
+        TIM4->CCER = 0U;
+        TIM4->CCMR1 = TIMER_INPUT_SELECTION[index];
+        TIM4->PSC = 0U;
+        TIM4->ARR = TIMER_PERIOD;
+        TIM4->SMCR = TIMER_TRIGGERS[index] | TIM_SLAVEMODE_EXTERNAL1;
+
+        // Loads PSC; the update flag it raises is not an overflow.
+        TIM4->EGR = TIM_EGR_UG;
+        TIM4->CNT = 0U;
+        TIM4->SR = 0U;
+        timerOverflows = 0U;
+
+        TIM4->DIER = TIM_DIER_UIE;
+        HAL_NVIC_SetPriority(TIM4_IRQn, 0U, 0U);
+        HAL_NVIC_EnableIRQ(TIM4_IRQn);
+
+        TIM4->CR1 = TIM_CR1_CEN;
+    }
+
+    auto stopTimer() noexcept -> void
+    {
+        TIM4->CR1 = 0U;
+        TIM4->DIER = 0U;
+        HAL_NVIC_DisableIRQ(TIM4_IRQn);
+        TIM4->SMCR = 0U;
+        TIM4->SR = 0U;
+    }
+
+    /**
+     * @brief Reads the TIM4 count extended to 32 bits by the overflow count.
+     */
+    [[nodiscard]] auto readTimer() noexcept -> Driver::PulseCount
+    {
+        std::uint16_t high{0U};
+        std::uint16_t low{0U};
+        bool pending{false};
+
+        // Retry if an overflow was handled between the two reads.
+        do
+        {
+            high = timerOverflows;
+            low = static_cast<std::uint16_t>(TIM4->CNT);
+            pending = ((TIM4->SR & TIM_SR_UIF) != 0U);
+        } while (high != timerOverflows);
+
+        // Overflow raised but not handled yet (e.g. read with interrupts masked).
+        if (pending && (low < TIMER_HALF_PERIOD))
+        {
+            ++high;
+        }
+
+        return (static_cast<Driver::PulseCount>(high) << TIMER_BITS) | low;
+    }
+
+    /**
+     * @brief TIM4 channel and DMA channel timestamping the pulses of one connector.
+     */
+    struct CaptureChannel final
+    {
+        /// nullptr if the connector cannot be captured.
+        DMA_Channel_TypeDef *dma{nullptr};
+        IRQn_Type irq{};
+        std::uint32_t completeFlag{0U};
+        std::uint32_t clearCompleteFlag{0U};
+        volatile std::uint32_t *compare{nullptr};
+        std::uint32_t ccmr1{0U};
+        std::uint32_t ccmr2{0U};
+        std::uint32_t ccer{0U};
+        std::uint32_t dier{0U};
+    };
+
+    /**
+     * @brief Returns the capture channel of connector @p index.
+     *
+     * @details
+     * PB6..PB9 are TIM4 CH1..CH4. CH1 requests DMA1 channel 1, which the light sensor ADC
+     * uses, and CH4 has no DMA request, so only bncB (CH2, DMA1 channel 4) and bncC (CH3,
+     * DMA1 channel 5) can be captured.
+     */
+    [[nodiscard]] auto getCaptureChannel(std::uint8_t index) noexcept -> CaptureChannel
+    {
+        CaptureChannel result{};
+
+        switch (index)
+        {
+        case 1U:
+            result = CaptureChannel{
+                .dma = DMA1_Channel4,
+                .irq = DMA1_Channel4_IRQn,
+                .completeFlag = DMA_ISR_TCIF4,
+                .clearCompleteFlag = DMA_IFCR_CTCIF4,
+                .compare = &TIM4->CCR2,
+                .ccmr1 = TIM_CCMR1_CC2S_0,
+                .ccmr2 = 0U,
+                .ccer = TIM_CCER_CC2E,
+                .dier = TIM_DIER_CC2DE};
+            break;
+
+        case 2U:
+            result = CaptureChannel{
+                .dma = DMA1_Channel5,
+                .irq = DMA1_Channel5_IRQn,
+                .completeFlag = DMA_ISR_TCIF5,
+                .clearCompleteFlag = DMA_IFCR_CTCIF5,
+                .compare = &TIM4->CCR3,
+                .ccmr1 = 0U,
+                .ccmr2 = TIM_CCMR2_CC3S_0,
+                .ccer = TIM_CCER_CC3E,
+                .dier = TIM_DIER_CC3DE};
+            break;
+
+        default:
+            break;
+        }
+
+        return result;
+    }
+
+    static_assert((Driver::CAPTURE_CAPACITY & (Driver::CAPTURE_CAPACITY - 1U)) == 0U,
+                  "The capture index wraps modulo 2^32, so the ring size must be a power of two");
+
+    /// Filled by DMA, one tick per pulse of the captured connector.
+    std::array<Driver::CaptureTick, Driver::CAPTURE_CAPACITY> captureRing{};
+
+    /// Channel of the connector in CAPTURE mode; valid while a connector is captured.
+    CaptureChannel captureChannel{};
+
+    /// Completed passes of the DMA over captureRing; incremented in the DMA interrupt.
+    volatile std::uint32_t captureLaps{0U};
+
+    /// Capture index at the previous harvest (CAPTURE mode).
+    std::uint32_t captureMark{0U};
+
+    /// Capture index of the oldest tick not yet returned by readCaptures().
+    std::uint32_t captureRead{0U};
+
+    /// Ticks overwritten by the DMA before they were read.
+    std::uint32_t captureLost{0U};
+
+    /**
+     * @brief Returns the number of ticks the DMA has stored since startCapture(), modulo 2^32.
+     */
+    [[nodiscard]] auto readCaptureIndex() noexcept -> std::uint32_t
+    {
+        std::uint32_t laps{0U};
+        std::uint32_t remaining{0U};
+        bool pending{false};
+
+        // Retry if a pass completed between the two reads.
+        do
+        {
+            laps = captureLaps;
+            remaining = captureChannel.dma->CNDTR;
+            pending = ((DMA1->ISR & captureChannel.completeFlag) != 0U);
+        } while (laps != captureLaps);
+
+        // CNDTR reloads to the ring size when a pass completes, so the position wraps to 0.
+        const std::uint32_t position = static_cast<std::uint32_t>(Driver::CAPTURE_CAPACITY) - remaining;
+
+        // Pass completed but not handled yet (e.g. read with interrupts masked).
+        if (pending && (position < (Driver::CAPTURE_CAPACITY / 2U)))
+        {
+            ++laps;
+        }
+
+        return (laps * static_cast<std::uint32_t>(Driver::CAPTURE_CAPACITY)) + position;
+    }
+
+    /**
+     * @brief Runs TIM4 from the core clock and lets every rising edge of @p channel store
+     *        the count in captureRing by DMA, with no interrupt per pulse.
+     */
+    auto startCaptureTimer(const CaptureChannel &channel, std::uint32_t tickHz) noexcept -> void
+    {
+        __HAL_RCC_TIM4_CLK_ENABLE();
+        __HAL_RCC_DMA1_CLK_ENABLE();
+
+        TIM4->CR1 = 0U;
+        TIM4->DIER = 0U;
+        TIM4->CCER = 0U;
+        TIM4->SMCR = 0U;
+        TIM4->CCMR1 = channel.ccmr1;
+        TIM4->CCMR2 = channel.ccmr2;
+        TIM4->PSC = (Driver::coreHz / tickHz) - 1U;
+        TIM4->ARR = TIMER_PERIOD;
+
+        // Loads PSC; the update flag it raises is not used in this mode.
+        TIM4->EGR = TIM_EGR_UG;
+        TIM4->CNT = 0U;
+        TIM4->SR = 0U;
+
+        channel.dma->CCR = 0U;
+        channel.dma->CPAR = reinterpret_cast<std::uintptr_t>(channel.compare);
+        channel.dma->CMAR = reinterpret_cast<std::uintptr_t>(captureRing.data());
+        channel.dma->CNDTR = Driver::CAPTURE_CAPACITY;
+        DMA1->IFCR = channel.clearCompleteFlag;
+        captureLaps = 0U;
+
+        // Peripheral to memory, 16-bit on both sides, one interrupt per pass over the ring.
+        channel.dma->CCR = DMA_CCR_PL_1 | DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_MINC | DMA_CCR_CIRC |
+                           DMA_CCR_TCIE;
+        HAL_NVIC_SetPriority(channel.irq, 0U, 0U);
+        HAL_NVIC_EnableIRQ(channel.irq);
+        channel.dma->CCR = channel.dma->CCR | DMA_CCR_EN;
+
+        TIM4->CCER = channel.ccer;
+        TIM4->DIER = channel.dier;
+        TIM4->CR1 = TIM_CR1_CEN;
+    }
+
+    auto stopCaptureTimer(const CaptureChannel &channel) noexcept -> void
+    {
+        TIM4->CR1 = 0U;
+        TIM4->DIER = 0U;
+        TIM4->CCER = 0U;
+        TIM4->SR = 0U;
+
+        channel.dma->CCR = 0U;
+        HAL_NVIC_DisableIRQ(channel.irq);
+        DMA1->IFCR = channel.clearCompleteFlag;
+    }
+
+    /**
+     * @brief Takes and zeroes the EXTI count of connector @p index in one atomic step.
+     *
+     * @details
+     * Compiles to an LDREX/STREX loop. Exception entry and return clear the exclusive
+     * monitor, so an EXTI increment between the load and the store makes the store fail and
+     * the exchange retry: no pulse is lost between reading and clearing.
+     */
+    [[nodiscard]] auto takePending(std::uint8_t index) noexcept -> Driver::PulseCount
+    {
+        return std::atomic_ref<Driver::PulseCount>{rawPulseCounters[index]}.exchange(0U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts one EXTI edge of connector @p index and stores when it arrived.
+     *
+     * Runs in the EXTI interrupt, which the main loop never preempts.
+     */
+    auto countEdge(std::uint8_t index) noexcept -> void
+    {
+        EdgeStamp &stamp = edgeStamps[index];
+
+        ++rawPulseCounters[index];
+        std::atomic_ref<Driver::CycleCpu>{stamp.cycles}.store(Driver::CycleClock::now(), std::memory_order_relaxed);
+        std::atomic_ref<Driver::PulseCount>{stamp.count}.store(stamp.count + 1U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the latest edge of connector @p index; main loop only.
+     */
+    [[nodiscard]] auto readEdgeStamp(std::uint8_t index) noexcept -> EdgeStamp
+    {
+        EdgeStamp &stamp = edgeStamps[index];
+        EdgeStamp result{};
+        Driver::PulseCount after{0U};
+
+        // An edge between the loads changes count, and its interrupt completes before the
+        // main loop resumes, so equal counts around the copy mean a consistent copy.
+        do
+        {
+            result.count = std::atomic_ref<Driver::PulseCount>{stamp.count}.load(std::memory_order_acquire);
+            result.cycles = std::atomic_ref<Driver::CycleCpu>{stamp.cycles}.load(std::memory_order_acquire);
+            after = std::atomic_ref<Driver::PulseCount>{stamp.count}.load(std::memory_order_acquire);
+        } while (result.count != after);
+
+        return result;
+    }
+
+    /**
+     * @brief Adds the pulses counted since the previous harvest to the running count of
+     *        connector @p index.
+     */
+    auto accumulate(std::uint8_t index) noexcept -> void
+    {
+        CountingState &state = countingStates[index];
+
+        if (state.mode == Driver::PulseCountingMode::TIMER)
+        {
+            // The timer is never reset while it counts; the difference survives its wrap.
+            const Driver::PulseCount timerCount = readTimer();
+
+            state.running += timerCount - state.timerMark;
+            state.timerMark = timerCount;
+        }
+        else if (state.mode == Driver::PulseCountingMode::CAPTURE)
+        {
+            // One tick per pulse, so the capture index is a pulse count as well.
+            const std::uint32_t captureIndex = readCaptureIndex();
+
+            state.running += captureIndex - captureMark;
+            captureMark = captureIndex;
+        }
+        else
+        {
+            state.running += takePending(index);
+        }
+    }
+
+    /**
+     * @brief Masks the gate interrupt for its lifetime, so the main loop can change the
+     *        counting state the gate harvests.
+     */
+    class GateLock final
+    {
+    public:
+        GateLock() noexcept
+        {
+            if (gateEnabled)
+            {
+                HAL_NVIC_DisableIRQ(TIM1_UP_IRQn);
+            }
+        }
+
+        ~GateLock()
+        {
+            if (gateEnabled)
+            {
+                HAL_NVIC_EnableIRQ(TIM1_UP_IRQn);
+            }
+        }
+
+        GateLock(const GateLock &) = delete;
+        GateLock &operator=(const GateLock &) = delete;
+        GateLock(GateLock &&) = delete;
+        GateLock &operator=(GateLock &&) = delete;
+    };
+
+    /**
+     * @brief Latches the running counts of all connectors at once; runs in TIM1_UP_IRQHandler.
+     */
+    auto latchGate() noexcept -> void
+    {
+        gateSnapshot.sequence.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        gateSnapshot.cycles = Driver::CycleClock::now();
+
+        for (std::uint8_t index = 0U; index < PULSE_COUNTER_COUNT; ++index)
+        {
+            accumulate(index);
+            gateSnapshot.counts[index] = countingStates[index].running;
+        }
+
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        gateSnapshot.sequence.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the count of connector @p index and the time of the latest gate.
+     * @return Number of that gate; 0 before the first gate.
+     */
+    auto readGate(std::uint8_t index, Driver::PulseCount &count, Driver::CycleCpu &cycles) noexcept -> std::uint32_t
+    {
+        std::uint32_t before{0U};
+        std::uint32_t after{0U};
+
+        do
+        {
+            before = gateSnapshot.sequence.load(std::memory_order_relaxed);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+
+            count = gateSnapshot.counts[index];
+            cycles = gateSnapshot.cycles;
+
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            after = gateSnapshot.sequence.load(std::memory_order_relaxed);
+        } while ((before != after) || ((before & 1U) != 0U));
+
+        return before / 2U;
+    }
+
+    /**
+     * @brief Hands connector @p index from EXTI over to TIM4, if it can clock the timer and
+     *        the timer is free.
+     */
+    auto switchToTimer(std::uint8_t index) noexcept -> void
+    {
+        if ((TIMER_TRIGGERS[index] != 0U) && (timerOwner == NO_TIMER_OWNER))
+        {
+            CountingState &state = countingStates[index];
+            const GateLock lock{};
+
+            // Masked first, so no EXTI pulse arrives after the last harvest.
+            EXTI->IMR = EXTI->IMR & ~static_cast<std::uint32_t>(EXTI_PINS[index]);
+            state.running += takePending(index);
+
+            startTimer(index);
+            state.timerMark = readTimer();
+            timerOwner = index;
+            state.mode = Driver::PulseCountingMode::TIMER;
+        }
+    }
+
+    /**
+     * @brief Hands connector @p index from TIM4 back to EXTI.
+     */
+    auto switchToInterrupt(std::uint8_t index) noexcept -> void
+    {
+        const GateLock lock{};
+
+        accumulate(index);
+        stopTimer();
+        timerOwner = NO_TIMER_OWNER;
+
+        // Edges seen while masked were counted by the timer; drop them before unmasking.
+        EXTI->PR = EXTI_PINS[index];
+        EXTI->IMR = EXTI->IMR | EXTI_PINS[index];
+
+        countingStates[index].mode = Driver::PulseCountingMode::INTERRUPT;
+    }
+
+    /**
+     * @brief Brings the total of connector @p index up to date and switches its counting
+     *        mode when the pulse rate calls for it.
+     *
+     * @details
+     * With gated sampling the total follows the latest gate instead of the live count.
+     */
+    auto refresh(std::uint8_t index) noexcept -> CountingState &
+    {
+        CountingState &state = countingStates[index];
+        Driver::PulseCount count{0U};
+
+        if (gateEnabled)
+        {
+            state.sampleGate = readGate(index, count, state.sampleCycles);
+        }
+        else
+        {
+            accumulate(index);
+            count = state.running;
+            state.sampleCycles = Driver::CycleClock::now();
+            state.sampleGate = 0U;
+        }
+
+        state.total += count - state.totalMark;
+        state.totalMark = count;
+
+        const Driver::PulseCountingMode wanted =
+            state.selector.update(static_cast<Driver::PulseCount>(state.total), state.sampleCycles, state.mode);
+
+        if (wanted != state.mode) [[unlikely]]
+        {
+            if (wanted == Driver::PulseCountingMode::TIMER)
+            {
+                switchToTimer(index);
+            }
+            else
+            {
+                switchToInterrupt(index);
+            }
+        }
+
+        return state;
+    }
 }
 
 // We are the client of PulseCounterId; verify enum values because
@@ -55,27 +644,69 @@ extern "C" void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
     switch (GPIO_Pin)
     {
     case GPIO_PIN_6:
-        ++rawPulseCounters[COUNTER_1];
+        countEdge(COUNTER_1);
         break;
     case GPIO_PIN_7:
-        ++rawPulseCounters[COUNTER_2];
+        countEdge(COUNTER_2);
         break;
     case GPIO_PIN_8:
-        ++rawPulseCounters[COUNTER_3];
+        countEdge(COUNTER_3);
         break;
     case GPIO_PIN_9:
-        ++rawPulseCounters[COUNTER_4];
+        countEdge(COUNTER_4);
         break;
     default:
         break;
     }
 }
 
+// TIM4 is not configured by CubeMX; this overrides the weak default handler of the vector table.
+// Runs once per 65536 pulses of the input that clocks TIM4.
+extern "C" void TIM4_IRQHandler(void)
+{
+    if ((TIM4->SR & TIM_SR_UIF) != 0U)
+    {
+        TIM4->SR = ~TIM_SR_UIF;
+        timerOverflows = static_cast<std::uint16_t>(timerOverflows + 1U);
+    }
+}
+
+// DMA1 channels 4 and 5 are not configured by CubeMX; these override the weak default handlers.
+// Run once per pass of the DMA over the capture ring, not per pulse.
+extern "C" void DMA1_Channel4_IRQHandler(void)
+{
+    if ((DMA1->ISR & DMA_ISR_TCIF4) != 0U)
+    {
+        DMA1->IFCR = DMA_IFCR_CTCIF4;
+        captureLaps = captureLaps + 1U;
+    }
+}
+
+extern "C" void DMA1_Channel5_IRQHandler(void)
+{
+    if ((DMA1->ISR & DMA_ISR_TCIF5) != 0U)
+    {
+        DMA1->IFCR = DMA_IFCR_CTCIF5;
+        captureLaps = captureLaps + 1U;
+    }
+}
+
+// TIM1 is not configured by CubeMX; this overrides the weak default handler of the vector table.
+// Same priority as EXTI, so no edge is counted while the gate latches the four counters.
+extern "C" void TIM1_UP_IRQHandler(void)
+{
+    if ((TIM1->SR & TIM_SR_UIF) != 0U)
+    {
+        TIM1->SR = ~TIM_SR_UIF;
+        latchGate();
+    }
+}
+
 namespace Driver
 {
 
     PulseCounterDriver::PulseCounterDriver(PulseCounterId deviceId) noexcept
-        : counter(rawPulseCounters[std::to_underlying(deviceId)])
+        : deviceId(deviceId)
     {
     }
 
@@ -87,12 +718,233 @@ namespace Driver
 
     auto PulseCounterDriver::read() const noexcept -> PulseCount
     {
-        return counter;
+        return static_cast<PulseCount>(refresh(std::to_underlying(deviceId)).total);
+    }
+
+    auto PulseCounterDriver::readSample() const noexcept -> PulseSample
+    {
+        const CountingState &state = refresh(std::to_underlying(deviceId));
+
+        // The cycle counter wraps every 59 s; a sample is always much younger than that.
+        const CycleTimestamp now = CycleClock::timestamp();
+        const CycleCpu age = CycleClock::now() - state.sampleCycles;
+
+        return PulseSample{
+            .count = static_cast<PulseCount>(state.total),
+            .timestamp = now - age,
+            .gate = state.sampleGate};
+    }
+
+    auto PulseCounterDriver::readLastEdge() const noexcept -> PulseEdge
+    {
+        const std::uint8_t index = std::to_underlying(deviceId);
+        PulseEdge result{};
+
+        if (refresh(index).mode == PulseCountingMode::INTERRUPT) [[likely]]
+        {
+            const EdgeStamp stamp = readEdgeStamp(index);
+
+            result = PulseEdge{.count = stamp.count, .cycles = stamp.cycles, .edgeTimed = true};
+        }
+        else
+        {
+            const PulseSample sample = readSample();
+
+            result = PulseEdge{.count = sample.count, .cycles = static_cast<CycleCpu>(sample.timestamp)};
+        }
+
+        return result;
+    }
+
+    auto PulseCounterDriver::getGate() const noexcept -> std::uint32_t
+    {
+        // The gate interrupt always completes before the main loop resumes, so the sequence
+        // is even here.
+        return gateEnabled ? (gateSnapshot.sequence.load(std::memory_order_relaxed) / 2U) : 0U;
+    }
+
+    auto PulseCounterDriver::readInterval() noexcept -> PulseCount
+    {
+        CountingState &state = refresh(std::to_underlying(deviceId));
+        const PulseCountTotal interval = state.total - state.intervalMark;
+
+        state.intervalMark = state.total;
+
+        return static_cast<PulseCount>(interval);
+    }
+
+    auto PulseCounterDriver::readTotal() const noexcept -> PulseCountTotal
+    {
+        return refresh(std::to_underlying(deviceId)).total;
+    }
+
+    auto PulseCounterDriver::getCountingMode() const noexcept -> PulseCountingMode
+    {
+        return countingStates[std::to_underlying(deviceId)].mode;
     }
 
     auto PulseCounterDriver::clear() noexcept -> void
     {
-        counter = 0U;
+        // Pulses arriving from here on stay pending and count after the clear.
+        CountingState &state = refresh(std::to_underlying(deviceId));
+
+        state.total = 0U;
+        state.intervalMark = 0U;
+        state.selector.reset(0U, CycleClock::now());
+    }
+
+    auto PulseCounterDriver::startCapture(std::uint32_t tickHz) noexcept -> bool
+    {
+        const std::uint8_t index = std::to_underlying(deviceId);
+        const CaptureChannel channel = getCaptureChannel(index);
+        const bool captured = (timerOwner != NO_TIMER_OWNER) &&
+                              (countingStates[timerOwner].mode == PulseCountingMode::CAPTURE);
+        const bool status = (channel.dma != nullptr) && isCaptureTickHzValid(tickHz) && !captured;
+
+        if (status)
+        {
+            // Capture needs TIM4 on the core clock; a connector counted by TIM4 returns to EXTI.
+            if (timerOwner != NO_TIMER_OWNER)
+            {
+                switchToInterrupt(timerOwner);
+            }
+
+            CountingState &state = countingStates[index];
+            const GateLock lock{};
+
+            // Masked first, so no EXTI pulse arrives after the last harvest.
+            EXTI->IMR = EXTI->IMR & ~static_cast<std::uint32_t>(EXTI_PINS[index]);
+            state.running += takePending(index);
+
+            captureChannel = channel;
+            startCaptureTimer(channel, tickHz);
+            captureMark = 0U;
+            captureRead = 0U;
+            captureLost = 0U;
+            timerOwner = index;
+            state.mode = PulseCountingMode::CAPTURE;
+        }
+
+        return status;
+    }
+
+    auto PulseCounterDriver::stopCapture() noexcept -> void
+    {
+        const std::uint8_t index = std::to_underlying(deviceId);
+        CountingState &state = countingStates[index];
+
+        if (state.mode == PulseCountingMode::CAPTURE)
+        {
+            const GateLock lock{};
+
+            accumulate(index);
+            stopCaptureTimer(captureChannel);
+            timerOwner = NO_TIMER_OWNER;
+
+            EXTI->PR = EXTI_PINS[index];
+            EXTI->IMR = EXTI->IMR | EXTI_PINS[index];
+
+            state.mode = PulseCountingMode::INTERRUPT;
+        }
+    }
+
+    auto PulseCounterDriver::readCaptures(std::span<CaptureTick> destination) noexcept -> std::size_t
+    {
+        std::size_t result{0U};
+
+        if (countingStates[std::to_underlying(deviceId)].mode == PulseCountingMode::CAPTURE)
+        {
+            const std::uint32_t written = readCaptureIndex();
+            std::uint32_t available = written - captureRead;
+
+            // The DMA lapped the reader: the oldest ticks are gone.
+            if (available > CAPTURE_CAPACITY)
+            {
+                captureLost += available - static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+                captureRead = written - static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+                available = static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+            }
+
+            const std::size_t count = std::min<std::size_t>(available, destination.size());
+
+            // Ring reads must not move before the index read that made them valid.
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+
+            for (std::size_t offset = 0U; offset < count; ++offset)
+            {
+                destination[offset] = captureRing[(captureRead + offset) % CAPTURE_CAPACITY];
+            }
+
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+
+            // Ticks the DMA overwrote while they were copied are not returned.
+            if ((readCaptureIndex() - captureRead) > CAPTURE_CAPACITY) [[unlikely]]
+            {
+                captureLost += static_cast<std::uint32_t>(count);
+            }
+            else
+            {
+                result = count;
+            }
+
+            captureRead += static_cast<std::uint32_t>(count);
+        }
+
+        return result;
+    }
+
+    auto PulseCounterDriver::getLostCaptures() const noexcept -> std::uint32_t
+    {
+        return captureLost;
+    }
+
+    auto PulseCounterDriver::startGatedSampling(std::uint32_t periodMs) noexcept -> bool
+    {
+        const bool status = (periodMs != 0U) && (periodMs <= GATE_MAX_PERIOD_MS);
+
+        if (status && !gateEnabled)
+        {
+            __HAL_RCC_TIM1_CLK_ENABLE();
+
+            TIM1->CR1 = 0U;
+            TIM1->PSC = GATE_TIMER_PRESCALER;
+            TIM1->ARR = (periodMs * GATE_TICKS_PER_MS) - 1U;
+            TIM1->RCR = 0U;
+
+            // Loads PSC; the update flag it raises is not a gate.
+            TIM1->EGR = TIM_EGR_UG;
+            TIM1->SR = 0U;
+
+            // The main loop stops harvesting from here on; the snapshot must already hold
+            // the current counts, or the first totals would step back.
+            for (std::uint8_t index = 0U; index < PULSE_COUNTER_COUNT; ++index)
+            {
+                static_cast<void>(refresh(index));
+            }
+
+            latchGate();
+            gateEnabled = true;
+
+            TIM1->DIER = TIM_DIER_UIE;
+            HAL_NVIC_SetPriority(TIM1_UP_IRQn, 0U, 0U);
+            HAL_NVIC_EnableIRQ(TIM1_UP_IRQn);
+            TIM1->CR1 = TIM_CR1_CEN;
+        }
+
+        return status;
+    }
+
+    auto PulseCounterDriver::stopGatedSampling() noexcept -> void
+    {
+        if (gateEnabled)
+        {
+            TIM1->CR1 = 0U;
+            TIM1->DIER = 0U;
+            HAL_NVIC_DisableIRQ(TIM1_UP_IRQn);
+            TIM1->SR = 0U;
+
+            gateEnabled = false;
+        }
     }
 
 } // namespace Driver
\ No newline at end of file
@@ -24,4 +24,14 @@ export namespace Driver
 
     static_assert(sizeof(CycleCpu) == sizeof(std::uint32_t),
                   "CycleCpu must remain a 32-bit unsigned integer type.");
+
+    /**
+     * @brief Monotonic CPU cycle count since CycleClock::init(), extended to 64 bits.
+     *
+     * @details
+     * Built from CycleCpu readings by counting their wrap-arounds (see CycleExtender). At
+     * 72 MHz it takes about 8000 years to wrap, so timestamps can be compared and subtracted
+     * directly.
+     */
+    using CycleTimestamp = std::uint64_t;
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+module;
+
+#include <cstdint>
+
+export module Driver.CycleExtender;
+
+import Driver.CycleCpu;
+
+export namespace Driver
+{
+    /**
+     * @brief Extends wrapping 32-bit cycle counter readings to a 64-bit time line.
+     *
+     * @details
+     * Adds the unsigned difference to the previous reading, so a wrap of the counter between
+     * two calls is absorbed. This requires at least one call per 2^32 cycles (about 59 s at
+     * 72 MHz); the measurement task samples every slot, which is far more often.
+     *
+     * Not interrupt safe: all calls must come from the same execution context.
+     */
+    class CycleExtender final
+    {
+    public:
+        /**
+         * @brief Restarts the time line at zero with @p origin as the current reading.
+         */
+        constexpr auto reset(CycleCpu origin = 0U) noexcept -> void
+        {
+            last = origin;
+            extended = 0U;
+        }
+
+        /**
+         * @brief Converts a counter reading into an extended timestamp.
+         *
+         * @param now Current counter reading; must not be older than the previous one.
+         */
+        [[nodiscard]] constexpr auto extend(CycleCpu now) noexcept -> CycleTimestamp
+        {
+            // Unsigned subtraction stays valid across the counter wrap.
+            extended += static_cast<CycleCpu>(now - last);
+            last = now;
+
+            return extended;
+        }
+
+    private:
+        CycleCpu last{0U};
+        CycleTimestamp extended{0U};
+    };
+} // namespace Driver
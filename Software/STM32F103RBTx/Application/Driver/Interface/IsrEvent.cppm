@@ -0,0 +1,82 @@
+module;
+
+#include <atomic>
+#include <cstdint>
+
+export module Driver.IsrEvent;
+
+export namespace Driver
+{
+    /**
+     * @brief Hardware events signalled from interrupt context.
+     *
+     * @details
+     * Values are used as bit positions in event masks, so they must stay below 32.
+     */
+    enum class IsrEvent : std::uint8_t
+    {
+        /**
+         * @brief An edge was counted on any pulse counter input (EXTI).
+         *
+         * @details
+         * Not raised yet: no task waits for it, and the EXTI handler runs once per pulse.
+         */
+        PULSE_COUNTER_EDGE = 0,
+
+        /// @brief The measurement UART went idle after receiving data. Not raised yet.
+        MEASUREMENT_UART_IDLE = 1,
+
+        /// @brief The light sensor ADC DMA transfer completed.
+        LIGHT_SENSOR_DMA_COMPLETE = 2,
+
+        LAST_NOT_USED = 3
+    };
+
+    /**
+     * @brief Forwards driver interrupt events to the application.
+     *
+     * @details
+     * Drivers must not depend on upper layers, so they report events through a single
+     * registered callback. The callback runs in interrupt context and must be short and
+     * ISR-safe. Without a registered callback events are dropped.
+     */
+    class IsrEventNotifier final
+    {
+    public:
+        using Callback = void (*)(IsrEvent event) noexcept;
+
+        IsrEventNotifier() = delete;
+        ~IsrEventNotifier() = delete;
+        IsrEventNotifier(const IsrEventNotifier &) = delete;
+        IsrEventNotifier &operator=(const IsrEventNotifier &) = delete;
+        IsrEventNotifier(IsrEventNotifier &&) = delete;
+        IsrEventNotifier &operator=(IsrEventNotifier &&) = delete;
+
+        /**
+         * @brief Sets the callback invoked by notify(); nullptr disables forwarding.
+         */
+        static auto registerCallback(Callback newCallback) noexcept -> void
+        {
+            callback.store(newCallback, std::memory_order_release);
+        }
+
+        /**
+         * @brief Reports an event. Intended to be called from interrupt context.
+         */
+        static auto notify(IsrEvent event) noexcept -> void
+        {
+            const Callback current = callback.load(std::memory_order_acquire);
+
+            if (current != nullptr)
+            {
+                current(event);
+            }
+        }
+
+    private:
+        inline static std::atomic<Callback> callback{nullptr};
+    };
+
+    static_assert(static_cast<std::uint8_t>(IsrEvent::LAST_NOT_USED) <= 32U,
+                  "IsrEvent values are used as bits in a 32-bit event mask.");
+}
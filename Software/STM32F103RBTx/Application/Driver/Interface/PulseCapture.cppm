@@ -0,0 +1,46 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+export module Driver.PulseCapture;
+
+import Driver.CoreClockConfig;
+
+export namespace Driver
+{
+    /**
+     * @brief Timer value latched by an input capture, one per pulse.
+     *
+     * @details
+     * The capture timer is 16 bits wide, so a tick only orders pulses less than
+     * CAPTURE_TICK_RANGE ticks apart. Inter-arrival times are taken as unsigned differences
+     * of consecutive ticks:
+     * @code
+     * CaptureTick interval = next - previous;
+     * @endcode
+     */
+    using CaptureTick = std::uint16_t;
+
+    /// Number of distinct tick values; the capture timer wraps after this many ticks.
+    inline constexpr std::uint32_t CAPTURE_TICK_RANGE{std::numeric_limits<CaptureTick>::max() + 1U};
+
+    /// Captures buffered by the driver; the ring must be drained faster than it fills.
+    inline constexpr std::size_t CAPTURE_CAPACITY{1'024U};
+
+    /**
+     * @brief Checks whether the capture timer can run at @p tickHz.
+     *
+     * @details
+     * The timer is clocked from the core clock through a 16-bit prescaler, so the tick rate
+     * must divide coreHz with a quotient of at most 65536.
+     */
+    [[nodiscard]] constexpr auto isCaptureTickHzValid(std::uint32_t tickHz) noexcept -> bool
+    {
+        return (tickHz != 0U) &&
+               (tickHz <= coreHz) &&
+               ((coreHz % tickHz) == 0U) &&
+               ((coreHz / tickHz) <= CAPTURE_TICK_RANGE);
+    }
+}
@@ -4,6 +4,8 @@ module;
 
 export module Driver.PulseCount;
 
+import Driver.CycleCpu;
+
 export namespace Driver
 {
     /**
@@ -14,4 +16,45 @@ export namespace Driver
      *
      */
     using PulseCount = std::uint32_t;
+
+    /**
+     * @brief Type alias for cumulative pulse totals.
+     *
+     * 64 bits do not wrap in practice: at 10 MHz they last for more than 50 000 years.
+     */
+    using PulseCountTotal = std::uint64_t;
+
+    /**
+     * @brief Pulse count together with the instant it was counted at.
+     */
+    struct PulseSample final
+    {
+        /// Pulses since the last clear(), modulo 2^32.
+        PulseCount count{0U};
+
+        /// Instant the count was latched at; the gate time with gated sampling.
+        CycleTimestamp timestamp{0U};
+
+        /// Number of the gate that latched count; 0 when counts are read live.
+        std::uint32_t gate{0U};
+    };
+
+    /**
+     * @brief Number of edges together with the instant of the latest one.
+     *
+     * @details
+     * Differences of count and cycles between two readings give the exact number of periods
+     * and their length, as long as the readings are less than 2^32 cycles (59 s) apart.
+     */
+    struct PulseEdge final
+    {
+        /// Free-running edge count, modulo 2^32; not affected by clear().
+        PulseCount count{0U};
+
+        /// Cycle counter at the latest edge, or at the read when edgeTimed is false.
+        CycleCpu cycles{0U};
+
+        /// false if the input is counted without per-edge interrupts and edges have no time.
+        bool edgeTimed{false};
+    };
 }
\ No newline at end of file
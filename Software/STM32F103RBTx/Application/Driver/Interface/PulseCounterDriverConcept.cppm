@@ -1,11 +1,14 @@
 module;
 
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 export module Driver.PulseCounterDriverConcept;
 
 import Driver.DriverComponent;
+import Driver.PulseCapture;
 import Driver.PulseCount;
 
 // import Driver.PulseCounterDriverConcept;
@@ -19,9 +22,20 @@ export namespace Driver::Concepts
     template <typename T>
     concept PulseCounterDriverConcept =
         std::derived_from<T, DriverComponent> &&
-        requires(T driver) {
+        requires(T driver, std::span<CaptureTick> ticks) {
             // Measurement operations - use the global type alias
             { driver.read() } noexcept -> std::same_as<PulseCount>;
+            { driver.readInterval() } noexcept -> std::same_as<PulseCount>;
+            { driver.readTotal() } noexcept -> std::same_as<PulseCountTotal>;
+            { driver.readSample() } noexcept -> std::same_as<PulseSample>;
+            { driver.getGate() } noexcept -> std::same_as<std::uint32_t>;
+            { driver.readLastEdge() } noexcept -> std::same_as<PulseEdge>;
             { driver.clear() } noexcept -> std::same_as<void>;
+
+            // Pulse timestamping
+            { driver.startCapture(std::uint32_t{}) } noexcept -> std::same_as<bool>;
+            { driver.stopCapture() } noexcept -> std::same_as<void>;
+            { driver.readCaptures(ticks) } noexcept -> std::same_as<std::size_t>;
+            { driver.getLostCaptures() } noexcept -> std::same_as<std::uint32_t>;
         };
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+module;
+
+#include <cstdint>
+
+export module Driver.PulseCountingMode;
+
+import Driver.CoreClockConfig;
+import Driver.CycleCpu;
+import Driver.PulseCount;
+
+export namespace Driver
+{
+    /**
+     * @enum PulseCountingMode
+     * @brief How a pulse counter input is counted.
+     */
+    enum class PulseCountingMode : std::uint8_t
+    {
+        /// One EXTI interrupt per pulse.
+        INTERRUPT = 0U,
+
+        /// The input clocks a hardware timer; no interrupt load per pulse.
+        TIMER = 1U,
+
+        /// Every pulse is timestamped by a timer input capture and stored by DMA.
+        CAPTURE = 2U
+    };
+
+    /**
+     * @brief Chooses the counting mode of one input from its observed pulse rate.
+     *
+     * @details
+     * The rate is evaluated once per EVALUATION_WINDOW_CYCLES from two counter readings, so
+     * it needs no interrupt of its own. Switching to TIMER happens above ENTER_TIMER_HZ and
+     * back to INTERRUPT below LEAVE_TIMER_HZ; the gap between both keeps a rate near a threshold
+     * from toggling the mode on every window.
+     *
+     * CAPTURE is chosen by the application, never by the selector; update() keeps it.
+     *
+     * Not interrupt safe: all calls must come from the same execution context.
+     */
+    class PulseCountingModeSelector final
+    {
+    public:
+        /// Rate above which EXTI interrupts would cost a noticeable share of the CPU.
+        static constexpr std::uint32_t ENTER_TIMER_HZ{20'000U};
+
+        /// Rate below which the per-edge events of EXTI are affordable again.
+        static constexpr std::uint32_t LEAVE_TIMER_HZ{5'000U};
+
+        /// Shortest interval between two rate evaluations (10 ms).
+        static constexpr CycleCpu EVALUATION_WINDOW_CYCLES{coreHz / 100U};
+
+        static_assert(LEAVE_TIMER_HZ < ENTER_TIMER_HZ, "Counting mode hysteresis must not be empty.");
+
+        /**
+         * @brief Restarts the evaluation window at @p now with @p count as baseline.
+         */
+        constexpr auto reset(PulseCount count, CycleCpu now) noexcept -> void
+        {
+            windowCount = count;
+            windowStart = now;
+        }
+
+        /**
+         * @brief Updates the selection with a new counter reading.
+         *
+         * @param count Current count; differences are taken modulo 2^32.
+         * @param now   Current cycle counter reading.
+         * @param mode  Mode the input is counted in now.
+         * @return Mode the input should be counted in.
+         */
+        [[nodiscard]] constexpr auto update(PulseCount count,
+                                            CycleCpu now,
+                                            PulseCountingMode mode) noexcept -> PulseCountingMode
+        {
+            PulseCountingMode result{mode};
+            const CycleCpu elapsed = now - windowStart;
+
+            if (elapsed >= EVALUATION_WINDOW_CYCLES)
+            {
+                // pulses / elapsed compared with Hz / coreHz, without a division.
+                const std::uint64_t pulses = static_cast<PulseCount>(count - windowCount);
+                const std::uint64_t scaledPulses = pulses * coreHz;
+
+                if ((mode == PulseCountingMode::INTERRUPT) &&
+                    (scaledPulses > (static_cast<std::uint64_t>(ENTER_TIMER_HZ) * elapsed)))
+                {
+                    result = PulseCountingMode::TIMER;
+                }
+                else if ((mode == PulseCountingMode::TIMER) &&
+                         (scaledPulses < (static_cast<std::uint64_t>(LEAVE_TIMER_HZ) * elapsed)))
+                {
+                    result = PulseCountingMode::INTERRUPT;
+                }
+
+                reset(count, now);
+            }
+
+            return result;
+        }
+
+    private:
+        PulseCount windowCount{0U};
+        CycleCpu windowStart{0U};
+    };
+} // namespace Driver
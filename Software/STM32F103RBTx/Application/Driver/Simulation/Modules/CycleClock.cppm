@@ -1,23 +1,48 @@
 module;
 
+#include <atomic>
 #include <cstdint>
 #include <type_traits>
 
-// #include "stm32f1xx.h"
-// #include "core_cm3.h" // DWT / CoreDebug
+#include <time.h>
 
 export module Driver.CycleClock;
 
 import Driver.CycleCpu;
+import Driver.CycleExtender;
+import Driver.CoreClockConfig;
 
 export namespace Driver
 {
+    /**
+     * @brief Time base used by the simulated cycle counter.
+     */
+    enum class CycleClockSource : std::uint8_t
+    {
+        /**
+         * @brief Host CLOCK_MONOTONIC_RAW scaled to coreHz.
+         *
+         * Cycle values follow wall-clock time as if the code ran on a 72 MHz core, so budget
+         * overruns of slow host code are reported like on the target.
+         */
+        MONOTONIC_RAW,
+
+        /**
+         * @brief Deterministic counter advanced explicitly with advance().
+         *
+         * Intended for unit tests and scripted simulations where repeatable timing matters.
+         */
+        VIRTUAL
+    };
 
     /**
-     * @brief Access to the CPU cycle counter (DWT->CYCCNT).
+     * @brief Simulated CPU cycle counter (replacement for DWT->CYCCNT).
      *
-     * This utility enables and reads the Cortex-M DWT cycle counter.
-     * It is intended for profiling and time measurements in CPU cycles.
+     * Provides the same interface as the hardware CycleClock. The counter wraps modulo 2^32
+     * like CYCCNT, so elapsed() behaves identically on both builds.
+     *
+     * In addition to the hardware interface, the simulation build can switch between a real
+     * host clock and a virtual clock (see CycleClockSource).
      */
     class CycleClock final
     {
@@ -31,27 +56,53 @@ export namespace Driver
         CycleClock &operator=(CycleClock &&) = delete;
 
         /**
-         * @brief Enable the DWT cycle counter and reset it to zero.
+         * @brief Reset the cycle counter to zero.
          *
-         * Precondition: DWT and CoreDebug are available for the selected target.
-         * Note: Some MCUs/cores may prevent enabling CYCCNT (e.g., due to debug/lock settings).
+         * For MONOTONIC_RAW the current host time becomes the new origin. For VIRTUAL the
+         * counter is set to zero. The selected source is kept.
          */
-        static constexpr auto init() noexcept -> void
+        static auto init() noexcept -> void
         {
-            //   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-            //   DWT->CYCCNT = 0U;
-            //   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+            originNs.store(readMonotonicNs(), std::memory_order_relaxed);
+            virtualCycles.store(0U, std::memory_order_relaxed);
+            extender.reset();
         }
 
         /**
          * @brief Read the current cycle counter value.
          *
-         * @return Current value of DWT->CYCCNT converted to CycleCpu.
+         * @return Cycles since init() from the selected source, modulo 2^32.
+         */
+        [[nodiscard]] static auto now() noexcept -> CycleCpu
+        {
+            CycleCpu result = 0U;
+
+            if (source.load(std::memory_order_relaxed) == CycleClockSource::VIRTUAL)
+            {
+                result = virtualCycles.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                const std::uint64_t elapsedNs =
+                    readMonotonicNs() - originNs.load(std::memory_order_relaxed);
+
+                result = static_cast<CycleCpu>(nsToCycles(elapsedNs));
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Read the cycle counter extended to 64 bits.
+         *
+         * @details
+         * Same contract as on the target: main loop only, at least once per counter wrap.
+         *
+         * @return Cycles since init().
          */
-        [[nodiscard]] static constexpr auto now() noexcept -> CycleCpu
+        [[nodiscard]] static auto timestamp() noexcept -> CycleTimestamp
         {
-            const std::uint32_t counter = 0; // DWT->CYCCNT;
-            return static_cast<CycleCpu>(counter);
+            return extender.extend(now());
         }
 
         /**
@@ -68,5 +119,71 @@ export namespace Driver
             const CycleCpu result = end - start;
             return result;
         }
+
+        /**
+         * @brief Select the time base returned by now().
+         *
+         * Switching does not reset the counter; call init() afterwards if a zero origin is needed.
+         */
+        static auto setSource(CycleClockSource newSource) noexcept -> void
+        {
+            source.store(newSource, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Return the currently selected time base.
+         */
+        [[nodiscard]] static auto getSource() noexcept -> CycleClockSource
+        {
+            return source.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Advance the virtual counter.
+         *
+         * Has no visible effect while MONOTONIC_RAW is selected. Safe to call from any thread
+         * (e.g. from a task under test to simulate execution time).
+         *
+         * @param cycles Number of cycles to add (wraps modulo 2^32).
+         */
+        static auto advance(CycleCpu cycles) noexcept -> void
+        {
+            virtualCycles.fetch_add(cycles, std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::uint64_t NS_PER_SECOND{1'000'000'000ULL};
+
+        [[nodiscard]] static auto readMonotonicNs() noexcept -> std::uint64_t
+        {
+            struct timespec ts{};
+            static_cast<void>(clock_gettime(CLOCK_MONOTONIC_RAW, &ts));
+
+            const std::uint64_t result =
+                (static_cast<std::uint64_t>(ts.tv_sec) * NS_PER_SECOND) +
+                static_cast<std::uint64_t>(ts.tv_nsec);
+
+            return result;
+        }
+
+        [[nodiscard]] static constexpr auto nsToCycles(std::uint64_t ns) noexcept -> std::uint64_t
+        {
+            // Split into seconds and remainder to avoid 64-bit overflow of ns * coreHz.
+            const std::uint64_t seconds = ns / NS_PER_SECOND;
+            const std::uint64_t remainderNs = ns % NS_PER_SECOND;
+
+            const std::uint64_t result =
+                (seconds * coreHz) + ((remainderNs * coreHz) / NS_PER_SECOND);
+
+            return result;
+        }
+
+        inline static std::atomic<CycleClockSource> source{CycleClockSource::MONOTONIC_RAW};
+        inline static std::atomic<std::uint64_t> originNs{0U};
+        inline static std::atomic<CycleCpu> virtualCycles{0U};
+        inline static CycleExtender extender{};
+
+        static_assert(std::is_unsigned_v<CycleCpu>,
+                      "CycleCpu must be unsigned. Wrap-around elapsed computation relies on modulo arithmetic.");
     };
-} // namespace Driver
\ No newline at end of file
+} // namespace Driver
@@ -1,13 +1,17 @@
 module;
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 export module Driver.PulseCounterDriver;
 
 import Driver.DriverComponent;
+import Driver.PulseCapture;
 import Driver.PulseCounterDriverConcept;
 import Driver.PulseCounterId;
 import Driver.PulseCount;
+import Driver.PulseCountingMode;
 
 export extern "C"
 {
@@ -34,8 +38,28 @@ export namespace Driver
 
         // Public interface
         [[nodiscard]] auto read() noexcept -> PulseCount;
+        [[nodiscard]] auto readInterval() noexcept -> PulseCount;
+        [[nodiscard]] auto readTotal() noexcept -> PulseCountTotal;
+        [[nodiscard]] auto readSample() noexcept -> PulseSample;
+        [[nodiscard]] auto getGate() const noexcept -> std::uint32_t;
+
+        /// Every simulated edge is timed, whatever the counting mode.
+        [[nodiscard]] auto readLastEdge() const noexcept -> PulseEdge;
         [[nodiscard]] auto clear() noexcept -> void;
 
+        /// Mode the hardware driver would count in; counting itself is the same in both modes.
+        [[nodiscard]] auto getCountingMode() const noexcept -> PulseCountingMode;
+
+        /// Same contract as on the target; any connector can be captured, ticks come from CycleClock.
+        [[nodiscard]] auto startCapture(std::uint32_t tickHz) noexcept -> bool;
+        auto stopCapture() noexcept -> void;
+        [[nodiscard]] auto readCaptures(std::span<CaptureTick> destination) noexcept -> std::size_t;
+        [[nodiscard]] auto getLostCaptures() const noexcept -> std::uint32_t;
+
+        /// Same contract as on the target; gates are latched by the first read after them.
+        [[nodiscard]] static auto startGatedSampling(std::uint32_t periodMs) noexcept -> bool;
+        static auto stopGatedSampling() noexcept -> void;
+
         // Lifecycle methods
         [[nodiscard]] auto onInit() noexcept -> bool { return true; }
         [[nodiscard]] auto onStart() noexcept -> bool { return true; }
@@ -43,6 +67,9 @@ export namespace Driver
 
     private:
         PulseCounterId deviceId;
+
+        PulseCountingModeSelector selector{};
+        PulseCountingMode mode{PulseCountingMode::INTERRUPT};
     };
 
     static_assert(Driver::Concepts::PulseCounterDriverConcept<PulseCounterDriver>,
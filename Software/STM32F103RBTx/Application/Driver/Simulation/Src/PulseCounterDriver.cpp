@@ -1,7 +1,11 @@
 module;
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <array>
+#include <atomic>
+#include <span>
 
 /*
 #include <print>
@@ -11,13 +15,115 @@ module;
 
 module Driver.PulseCounterDriver;
 
+import Driver.CoreClockConfig;
+import Driver.CycleClock;
+import Driver.PulseCapture;
 import Driver.PulseCounterId;
+import Driver.PulseCountingMode;
 
 namespace
 {
-    std::array<Driver::PulseCount,
-               Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT>
-        pulseCounters = {0};
+    // Incremented by the PulseCounterScheduler threads; holds the pulses since the last harvest.
+    alignas(std::atomic_ref<Driver::PulseCount>::required_alignment)
+        std::array<Driver::PulseCount,
+                   Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT>
+            pulseCounters = {0};
+
+    /// Pulses since the last clear(), per connector.
+    std::array<Driver::PulseCountTotal, Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT> totals = {0};
+
+    /// Total at the previous readInterval() or clear(), per connector.
+    std::array<Driver::PulseCountTotal, Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT> intervalMarks = {0};
+
+    /// Edge count (high half) and cycle counter at the latest edge (low half), per connector.
+    /// One word, so the pair is read consistently without a lock.
+    std::array<std::atomic<std::uint64_t>, Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT> edgeStamps{};
+
+    constexpr std::uint32_t EDGE_COUNT_SHIFT{32U};
+
+    /// Moves the pending pulses of one connector into its total; same exchange as on the target.
+    auto harvest(std::uint8_t index) noexcept -> Driver::PulseCountTotal
+    {
+        totals[index] += std::atomic_ref<Driver::PulseCount>{pulseCounters[index]}.exchange(0U);
+
+        return totals[index];
+    }
+
+    constexpr std::uint8_t NO_CAPTURE{Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT};
+
+    /// Connector whose pulses are timestamped, or NO_CAPTURE.
+    std::atomic<std::uint8_t> capturedCounter{NO_CAPTURE};
+
+    /// Core cycles per capture tick.
+    std::uint32_t captureDivider{1U};
+
+    /// Written by the PulseCounterScheduler thread of the captured connector, like the DMA ring.
+    std::array<Driver::CaptureTick, Driver::CAPTURE_CAPACITY> captureRing{};
+    std::atomic<std::uint32_t> captureWritten{0U};
+    std::uint32_t captureRead{0U};
+    std::uint32_t captureLost{0U};
+
+    /// Same range as the TIM1 gate of the target.
+    constexpr std::uint32_t GATE_MAX_PERIOD_MS{6'553U};
+
+    /// Gate period in cycles; 0 while gated sampling is off.
+    Driver::CycleTimestamp gatePeriod{0U};
+
+    /// Time of gate 1.
+    Driver::CycleTimestamp gateOrigin{0U};
+
+    /// Latest gate latched into latchedTotals.
+    std::uint32_t latchedGate{0U};
+
+    std::array<Driver::PulseCountTotal, Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT> latchedTotals = {0};
+
+    /// Number of the gate that has passed last at @p now; 0 while gated sampling is off.
+    auto gateAt(Driver::CycleTimestamp now) noexcept -> std::uint32_t
+    {
+        std::uint32_t gate{0U};
+
+        if (gatePeriod != 0U)
+        {
+            gate = static_cast<std::uint32_t>(((now - gateOrigin) / gatePeriod) + 1U);
+        }
+
+        return gate;
+    }
+
+    /**
+     * @brief Total of connector @p index as the target would report it.
+     *
+     * There is no timer interrupt on the host: a passed gate is latched for all connectors
+     * at once by the first read after it. The counts are therefore coherent like on the
+     * target, but taken slightly later than the gate time they are reported with.
+     */
+    auto sampleTotal(std::uint8_t index) noexcept -> Driver::PulseCountTotal
+    {
+        Driver::PulseCountTotal result{0U};
+
+        if (gatePeriod != 0U)
+        {
+            const std::uint32_t gate = gateAt(Driver::CycleClock::timestamp());
+
+            if (gate != latchedGate)
+            {
+                for (std::uint8_t counter = 0U; counter < Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT; ++counter)
+                {
+                    latchedTotals[counter] = harvest(counter);
+                }
+
+                latchedGate = gate;
+            }
+
+            result = latchedTotals[index];
+        }
+        else
+        {
+            result = harvest(index);
+        }
+
+        return result;
+    }
 }
 
 extern "C"
@@ -27,7 +133,22 @@ extern "C"
     {
         if (counterId < Driver::PulseCounterDriver::PULSE_COUNTER_AMOUNT)
         {
-            pulseCounters[counterId]++;
+            std::atomic_ref<Driver::PulseCount>{pulseCounters[counterId]}.fetch_add(1U);
+
+            // Single writer per connector: its PulseCounterScheduler thread.
+            const std::uint64_t edges = (edgeStamps[counterId].load(std::memory_order_relaxed) >> EDGE_COUNT_SHIFT) + 1U;
+            edgeStamps[counterId].store((edges << EDGE_COUNT_SHIFT) | Driver::CycleClock::now(), std::memory_order_release);
+
+            if (counterId == capturedCounter.load(std::memory_order_acquire))
+            {
+                // The cycle counter wraps at 2^32, so one interval per wrap is off unless the
+                // divider is a power of two; negligible for a simulation.
+                const std::uint32_t written = captureWritten.load(std::memory_order_relaxed);
+
+                captureRing[written % Driver::CAPTURE_CAPACITY] =
+                    static_cast<Driver::CaptureTick>(Driver::CycleClock::now() / captureDivider);
+                captureWritten.store(written + 1U, std::memory_order_release);
+            }
         }
     }
 }
@@ -47,10 +168,159 @@ namespace Driver
         //  std::println(stdout, " {} {} {}",
         //               std::source_location::current().function_name(), index, pulseCounters[index]);
 
-        return pulseCounters[index];
+        const auto count = static_cast<PulseCount>(sampleTotal(index));
+
+        // Same rate-based switching as the hardware driver, so the simulator reports the mode
+        // the firmware would use. Sharing of TIM4 between bncA and bncB is not modelled.
+        mode = selector.update(count, CycleClock::now(), mode);
+
+        return count;
+    }
+
+    auto PulseCounterDriver::getCountingMode() const noexcept -> PulseCountingMode
+    {
+        return mode;
+    }
+
+    auto PulseCounterDriver::readInterval() noexcept -> PulseCount
+    {
+        const auto index = static_cast<std::uint8_t>(deviceId);
+        const PulseCountTotal total = sampleTotal(index);
+        const PulseCountTotal interval = total - intervalMarks[index];
+
+        intervalMarks[index] = total;
+
+        return static_cast<PulseCount>(interval);
+    }
+
+    auto PulseCounterDriver::readTotal() noexcept -> PulseCountTotal
+    {
+        return sampleTotal(static_cast<std::uint8_t>(deviceId));
+    }
+
+    auto PulseCounterDriver::readSample() noexcept -> PulseSample
+    {
+        const PulseCount count = read();
+        const CycleTimestamp timestamp = (latchedGate != 0U)
+                                             ? gateOrigin + ((latchedGate - 1U) * gatePeriod)
+                                             : CycleClock::timestamp();
+
+        return PulseSample{.count = count, .timestamp = timestamp, .gate = latchedGate};
+    }
+
+    auto PulseCounterDriver::readLastEdge() const noexcept -> PulseEdge
+    {
+        const std::uint64_t stamp = edgeStamps[static_cast<std::uint8_t>(deviceId)].load(std::memory_order_acquire);
+
+        return PulseEdge{
+            .count = static_cast<PulseCount>(stamp >> EDGE_COUNT_SHIFT),
+            .cycles = static_cast<CycleCpu>(stamp),
+            .edgeTimed = true};
+    }
+
+    auto PulseCounterDriver::getGate() const noexcept -> std::uint32_t
+    {
+        return gateAt(CycleClock::timestamp());
+    }
+
+    auto PulseCounterDriver::startCapture(std::uint32_t tickHz) noexcept -> bool
+    {
+        const auto index = static_cast<std::uint8_t>(deviceId);
+        const bool status = isCaptureTickHzValid(tickHz) &&
+                            (capturedCounter.load(std::memory_order_relaxed) == NO_CAPTURE);
+
+        if (status)
+        {
+            captureDivider = coreHz / tickHz;
+            captureWritten.store(0U, std::memory_order_relaxed);
+            captureRead = 0U;
+            captureLost = 0U;
+            capturedCounter.store(index, std::memory_order_release);
+            mode = PulseCountingMode::CAPTURE;
+        }
+
+        return status;
+    }
+
+    auto PulseCounterDriver::stopCapture() noexcept -> void
+    {
+        if (mode == PulseCountingMode::CAPTURE)
+        {
+            capturedCounter.store(NO_CAPTURE, std::memory_order_release);
+            mode = PulseCountingMode::INTERRUPT;
+        }
+    }
+
+    auto PulseCounterDriver::readCaptures(std::span<CaptureTick> destination) noexcept -> std::size_t
+    {
+        std::size_t result{0U};
+
+        if (mode == PulseCountingMode::CAPTURE)
+        {
+            const std::uint32_t written = captureWritten.load(std::memory_order_acquire);
+            std::uint32_t available = written - captureRead;
+
+            if (available > CAPTURE_CAPACITY)
+            {
+                captureLost += available - static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+                captureRead = written - static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+                available = static_cast<std::uint32_t>(CAPTURE_CAPACITY);
+            }
+
+            const std::size_t count = std::min<std::size_t>(available, destination.size());
+
+            for (std::size_t offset = 0U; offset < count; ++offset)
+            {
+                destination[offset] = captureRing[(captureRead + offset) % CAPTURE_CAPACITY];
+            }
+
+            if ((captureWritten.load(std::memory_order_acquire) - captureRead) > CAPTURE_CAPACITY) [[unlikely]]
+            {
+                captureLost += static_cast<std::uint32_t>(count);
+            }
+            else
+            {
+                result = count;
+            }
+
+            captureRead += static_cast<std::uint32_t>(count);
+        }
+
+        return result;
+    }
+
+    auto PulseCounterDriver::getLostCaptures() const noexcept -> std::uint32_t
+    {
+        return captureLost;
+    }
+
+    auto PulseCounterDriver::startGatedSampling(std::uint32_t periodMs) noexcept -> bool
+    {
+        const bool status = (periodMs != 0U) && (periodMs <= GATE_MAX_PERIOD_MS);
+
+        if (status && (gatePeriod == 0U))
+        {
+            gateOrigin = CycleClock::timestamp();
+            gatePeriod = static_cast<CycleTimestamp>(periodMs) * (coreHz / 1'000U);
+            latchedGate = 0U;
+        }
+
+        return status;
+    }
+
+    auto PulseCounterDriver::stopGatedSampling() noexcept -> void
+    {
+        gatePeriod = 0U;
+        latchedGate = 0U;
     }
 
     auto PulseCounterDriver::clear() noexcept -> void
     {
+        const auto index = static_cast<std::uint8_t>(deviceId);
+
+        static_cast<void>(harvest(index));
+        totals[index] = 0U;
+        latchedTotals[index] = 0U;
+        intervalMarks[index] = 0U;
     }
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 module;
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <print>
 #include <utility>
 #include <source_location>
+#include <span>
 
 export module SimulationBindings;
 
@@ -28,6 +30,10 @@ import Driver.PulseCounterId;
 
 import Simulation.PulseCounterScheduler;
 
+import Driver.CycleClock;
+import Driver.CycleCpu;
+import Driver.IsrEvent;
+
 static Driver::LightSensorDriver lightSensor;
 static Driver::BrightnessDriver displayBrightness;
 static Driver::DisplayDriver display;
@@ -72,6 +78,10 @@ extern "C"
 
     void LibWrapper_Init()
     {
+        Driver::IsrEventNotifier::registerCallback(
+            [](Driver::IsrEvent event) noexcept
+            { facade.onIsrEvent(event); });
+
         if (!facade.init())
         {
             std::println(stderr, "ERROR {} failed!",
@@ -126,6 +136,88 @@ extern "C"
         facade.onTimeSlot();
     }
 
+    void LibWrapper_TimeSlotsElapsed(std::uint32_t elapsedSlots)
+    {
+        facade.onTimeSlotsElapsed(elapsedSlots);
+    }
+
+    std::uint32_t LibWrapper_GetIdleSlots(std::uint32_t maxSlots)
+    {
+        return facade.getIdleSlots(maxSlots);
+    }
+
+    bool LibWrapper_DumpSchedulerProfile()
+    {
+        return facade.dumpSchedulerProfile();
+    }
+
+    std::size_t LibWrapper_ReadTrace(std::uint8_t *buffer, std::size_t size)
+    {
+        std::size_t result = 0U;
+
+        if (buffer != nullptr)
+        {
+            result = facade.readTrace(std::span<std::uint8_t>{buffer, size});
+        }
+
+        return result;
+    }
+
+    void LibWrapper_UseVirtualCycleClock(bool useVirtual)
+    {
+        const auto source = useVirtual ? Driver::CycleClockSource::VIRTUAL
+                                       : Driver::CycleClockSource::MONOTONIC_RAW;
+
+        Driver::CycleClock::setSource(source);
+    }
+
+    void LibWrapper_AdvanceCycleClock(Driver::CycleCpu cycles)
+    {
+        Driver::CycleClock::advance(cycles);
+    }
+
+    bool LibWrapper_IsSchedulerLagging()
+    {
+        return facade.getSchedulerStatus().schedulerLag;
+    }
+
+    bool LibWrapper_IsSlotOverrun()
+    {
+        return facade.getSchedulerStatus().slotOverrun;
+    }
+
+    void LibWrapper_GetDispatchLatency(Driver::CycleCpu *mean, Driver::CycleCpu *max, Driver::CycleCpu *jitterMax)
+    {
+        const auto &status = facade.getSchedulerStatus();
+
+        if ((mean != nullptr) && (max != nullptr) && (jitterMax != nullptr))
+        {
+            *mean = status.dispatchLatency.mean();
+            *max = status.dispatchLatency.max;
+            *jitterMax = status.dispatchJitterMax;
+        }
+    }
+
+    void LibWrapper_GetRecorderStats(std::size_t recorderIndex,
+                                     std::uint32_t *delivered,
+                                     std::uint32_t *dropped,
+                                     std::uint32_t *coalesced,
+                                     std::uint32_t *highWater,
+                                     std::uint32_t *rejected)
+    {
+        const auto stats = facade.getRecorderQueueStats(recorderIndex);
+
+        if ((delivered != nullptr) && (dropped != nullptr) && (coalesced != nullptr) && (highWater != nullptr) &&
+            (rejected != nullptr))
+        {
+            *delivered = stats.delivered;
+            *dropped = stats.dropped;
+            *coalesced = stats.coalesced;
+            *highWater = stats.highWater;
+            *rejected = stats.rejected;
+        }
+    }
+
     void LibWrapper_KeyPressed(Driver::KeyId keyId)
     {
         auto &keyboard = static_cast<Driver::KeyboardDriver &>(platform.keyboard);
@@ -0,0 +1,115 @@
+/**
+ * @file PipelineBenchmark.cpp
+ * @brief Measures the host cost of measurement pipeline stages.
+ *
+ * Usage: PipelineBenchmark [measurements]
+ *
+ * Runs the same pseudo-random measurement stream through several pipelines and prints the
+ * time per measurement and the time per stage relative to the empty pipeline. Host numbers
+ * do not translate to Cortex-M3 cycles one to one, but they show the relative cost of the
+ * stages and that an empty pipeline is free.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <print>
+#include <string_view>
+#include <variant>
+
+import BusinessLogic.MeasurementPipeline;
+import Device.MeasurementDeviceId;
+import Device.MeasurementType;
+
+namespace
+{
+    using BusinessLogic::DeadbandStage;
+    using BusinessLogic::DecimateStage;
+    using BusinessLogic::MovingAverageStage;
+    using BusinessLogic::Pipeline;
+    using BusinessLogic::ScaleStage;
+
+    constexpr std::size_t DEFAULT_MEASUREMENTS{10'000'000U};
+
+    struct Result final
+    {
+        double nsPerMeasurement{0.0};
+        std::uint64_t checksum{0U};
+    };
+
+    /**
+     * @brief Feeds measurements through a pipeline and times the loop.
+     *
+     * @details
+     * The input is a linear congruential sequence so the compiler cannot fold the stages,
+     * and the checksum of the passed values keeps the results alive.
+     */
+    template <typename P>
+    auto measure(std::size_t measurements) -> Result
+    {
+        P pipeline;
+        std::uint32_t seed = 1U;
+        std::uint64_t checksum = 0U;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0U; i < measurements; ++i)
+        {
+            seed = (seed * 1'664'525U) + 1'013'904'223U;
+
+            Device::MeasurementType measurement{.source = Device::MeasurementDeviceId::PULSE_COUNTER_1,
+                                                .data = std::uint32_t{seed >> 20U}};
+
+            if (pipeline.process(measurement))
+            {
+                checksum += std::get<std::uint32_t>(measurement.data);
+            }
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+
+        return Result{.nsPerMeasurement = ns / static_cast<double>(measurements), .checksum = checksum};
+    }
+
+    template <typename P>
+    auto report(std::string_view name, std::size_t measurements, double baselineNs) -> double
+    {
+        const Result result = measure<P>(measurements);
+        const double perStage = (P::STAGE_COUNT != 0U)
+                                    ? ((result.nsPerMeasurement - baselineNs) / static_cast<double>(P::STAGE_COUNT))
+                                    : 0.0;
+
+        std::println("{:<40} {:>8} {:>12.3f} {:>12.3f} {:>20}",
+                     name, P::STAGE_COUNT, result.nsPerMeasurement, perStage, result.checksum);
+
+        return result.nsPerMeasurement;
+    }
+}
+
+auto main(int argc, char **argv) -> int
+{
+    const std::size_t measurements =
+        (argc > 1) ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : DEFAULT_MEASUREMENTS;
+
+    if (measurements == 0U)
+    {
+        std::println(stderr, "usage: PipelineBenchmark [measurements]");
+        return EXIT_FAILURE;
+    }
+
+    std::println("{:<40} {:>8} {:>12} {:>12} {:>20}", "pipeline", "stages", "ns/meas", "ns/stage", "checksum");
+
+    const double baseline = report<Pipeline<>>("empty", measurements, 0.0);
+
+    (void)report<Pipeline<ScaleStage<200U, 1U>>>("scale", measurements, baseline);
+    (void)report<Pipeline<DecimateStage<4U>>>("decimate", measurements, baseline);
+    (void)report<Pipeline<MovingAverageStage<16U>>>("moving average (16)", measurements, baseline);
+    (void)report<Pipeline<DeadbandStage<8U>>>("deadband", measurements, baseline);
+    (void)report<Pipeline<ScaleStage<200U, 1U>, MovingAverageStage<16U>>>("scale + moving average", measurements, baseline);
+    (void)report<Pipeline<MovingAverageStage<16U>, DeadbandStage<8U>, ScaleStage<200U, 1U>>>(
+        "moving average + deadband + scale", measurements, baseline);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file TraceDecoder.cpp
+ * @brief Converts scheduler trace blocks into Chrome trace JSON.
+ *
+ * Usage: TraceDecoder [capture.bin] > trace.json
+ *
+ * Reads the raw byte stream captured from the USB UART (or returned by the simulation's
+ * read_trace()) from the given file or stdin, finds TraceWire blocks by their magic and writes
+ * a JSON document that can be opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+import BusinessLogic.TraceFormat;
+
+namespace
+{
+    using BusinessLogic::TraceBlockHeader;
+    using BusinessLogic::TraceEventType;
+    using BusinessLogic::TraceRecord;
+    using BusinessLogic::TraceWire;
+
+    /// Chrome trace thread ids used to separate the event kinds into rows.
+    constexpr int SLOT_THREAD{0};
+    constexpr int TASK_THREAD{1};
+    constexpr int ISR_THREAD{2};
+    constexpr int RECORDER_THREAD{3};
+
+    constexpr std::array<std::string_view, 5U> TASK_NAMES{"MEASUREMENT", "KEYBOARD", "WIFI_RECORDER",
+                                                          "SD_CARD_RECORDER", "PULSE_CAPTURE"};
+    constexpr std::array<std::string_view, 3U> ISR_EVENT_NAMES{"PULSE_COUNTER_EDGE",
+                                                               "MEASUREMENT_UART_IDLE",
+                                                               "LIGHT_SENSOR_DMA_COMPLETE"};
+
+    auto nameOf(std::span<const std::string_view> names, std::uint8_t id) -> std::string
+    {
+        return (id < names.size()) ? std::string{names[id]} : std::format("#{}", id);
+    }
+
+    /**
+     * @brief Extends wrapping 32-bit cycle stamps to a monotonic 64-bit time line.
+     *
+     * @details
+     * An interrupt can store its record between the stamp and the store of an interrupted
+     * record, so a record may be a little older than the one before it. The delta is therefore
+     * signed: consecutive records are assumed to be less than 2^31 cycles apart (about 30 s at
+     * 72 MHz), and the delta then survives counter wrap-around in both directions.
+     */
+    class Timeline final
+    {
+    public:
+        auto toMicroseconds(std::uint32_t timestamp, std::uint32_t cycleHz) -> double
+        {
+            if (started)
+            {
+                cycles += static_cast<std::int32_t>(timestamp - last);
+            }
+
+            started = true;
+            last = timestamp;
+
+            return (cycleHz != 0U) ? (static_cast<double>(cycles) * 1.0e6 / static_cast<double>(cycleHz))
+                                   : static_cast<double>(cycles);
+        }
+
+    private:
+        bool started{false};
+        std::uint32_t last{0U};
+        std::int64_t cycles{0};
+    };
+
+    class ChromeTraceWriter final
+    {
+    public:
+        explicit ChromeTraceWriter(std::FILE *output) : out(output)
+        {
+            std::print(out, "{{\"traceEvents\":[");
+        }
+
+        ~ChromeTraceWriter()
+        {
+            std::println(out, "\n]}}");
+        }
+
+        ChromeTraceWriter(const ChromeTraceWriter &) = delete;
+        ChromeTraceWriter &operator=(const ChromeTraceWriter &) = delete;
+        ChromeTraceWriter(ChromeTraceWriter &&) = delete;
+        ChromeTraceWriter &operator=(ChromeTraceWriter &&) = delete;
+
+        auto write(const TraceRecord &record, double us) -> void
+        {
+            switch (record.type)
+            {
+            case TraceEventType::SLOT_START:
+                event("B", std::format("slot {}", record.id), SLOT_THREAD, us);
+                break;
+
+            case TraceEventType::SLOT_END:
+                event("E", std::format("slot {}", record.id), SLOT_THREAD, us);
+                break;
+
+            case TraceEventType::TASK_START:
+                event("B", nameOf(TASK_NAMES, record.id), TASK_THREAD, us);
+                break;
+
+            case TraceEventType::TASK_END:
+                event("E", nameOf(TASK_NAMES, record.id), TASK_THREAD, us,
+                      std::format("\"ok\":{}", record.arg != 0U));
+                break;
+
+            case TraceEventType::ISR_TIME_SLOT:
+                event("i", "TIME_SLOT", ISR_THREAD, us, std::format("\"elapsed\":{}", record.arg));
+                break;
+
+            case TraceEventType::ISR_EVENT:
+                event("i", nameOf(ISR_EVENT_NAMES, record.id), ISR_THREAD, us);
+                break;
+
+            case TraceEventType::RECORDER_NOTIFY:
+                event("i", std::format("recorder {}", record.id), RECORDER_THREAD, us,
+                      std::format("\"measurements\":{}", record.arg));
+                break;
+
+            default:
+                event("i", std::format("unknown type {}", std::to_underlying(record.type)), SLOT_THREAD, us);
+                break;
+            }
+        }
+
+        auto writeDropped(std::uint32_t dropped, double us) -> void
+        {
+            event("i", std::format("dropped {} records", dropped), SLOT_THREAD, us);
+        }
+
+    private:
+        auto event(std::string_view phase, std::string_view name, int tid, double us,
+                   std::string_view args = {}) -> void
+        {
+            std::print(out, "{}\n{{\"name\":\"{}\",\"ph\":\"{}\",\"ts\":{:.3f},\"pid\":0,\"tid\":{}",
+                       first ? "" : ",", name, phase, us, tid);
+
+            if (phase == "i")
+            {
+                std::print(out, ",\"s\":\"t\"");
+            }
+
+            if (!args.empty())
+            {
+                std::print(out, ",\"args\":{{{}}}", args);
+            }
+
+            std::print(out, "}}");
+            first = false;
+        }
+
+        std::FILE *out;
+        bool first{true};
+    };
+
+    auto readAll(int argc, char **argv, std::vector<std::uint8_t> &data) -> bool
+    {
+        bool result = true;
+
+        if (argc > 1)
+        {
+            std::ifstream file{argv[1], std::ios::binary};
+            result = file.is_open();
+            data.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        }
+        else
+        {
+            data.assign(std::istreambuf_iterator<char>{std::cin}, std::istreambuf_iterator<char>{});
+        }
+
+        return result;
+    }
+} // namespace
+
+auto main(int argc, char **argv) -> int
+{
+    std::vector<std::uint8_t> data;
+    int status = 0;
+
+    if (!readAll(argc, argv, data))
+    {
+        std::println(stderr, "TraceDecoder: cannot open {}", argv[1]);
+        status = 1;
+    }
+    else
+    {
+        const std::span<const std::uint8_t> stream{data};
+        ChromeTraceWriter writer{stdout};
+        Timeline timeline;
+        double lastUs = 0.0;
+        std::size_t offset = 0U;
+        std::size_t blocks = 0U;
+
+        while ((offset + TraceWire::HEADER_SIZE) <= stream.size())
+        {
+            TraceBlockHeader header{};
+            const std::size_t payload = TraceWire::HEADER_SIZE;
+
+            if (TraceWire::decodeHeader(stream.subspan(offset), header) &&
+                ((offset + payload + (header.recordCount * TraceWire::RECORD_SIZE)) <= stream.size()))
+            {
+                if (header.droppedRecords != 0U)
+                {
+                    writer.writeDropped(header.droppedRecords, lastUs);
+                }
+
+                for (std::size_t i = 0U; i < header.recordCount; ++i)
+                {
+                    const TraceRecord record =
+                        TraceWire::decodeRecord(stream.subspan(offset + payload + (i * TraceWire::RECORD_SIZE)));
+                    lastUs = timeline.toMicroseconds(record.timestamp, header.cycleHz);
+                    writer.write(record, lastUs);
+                }
+
+                offset += payload + (header.recordCount * TraceWire::RECORD_SIZE);
+                ++blocks;
+            }
+            else
+            {
+                // Not a block (other UART output or a truncated block): resynchronise on the next byte.
+                ++offset;
+            }
+        }
+
+        std::println(stderr, "TraceDecoder: {} blocks decoded", blocks);
+    }
+
+    return status;
+}
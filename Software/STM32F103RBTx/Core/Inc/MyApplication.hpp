@@ -24,6 +24,30 @@ extern "C"
      */
     void app_timeSlotIsr(void);
 
+    /**
+     * Tickless idle variant of app_timeSlotIsr().
+     * Called from the timer ISR when its period covered elapsedSlots scheduler slots.
+     */
+    void app_timeSlotsElapsedIsr(uint32_t elapsedSlots);
+
+    /**
+     * Called from the main loop before sleeping.
+     * Returns the number of slot periods (1..maxSlots) until the next slot with work.
+     */
+    uint32_t app_getIdleSlots(uint32_t maxSlots);
+
+    /**
+     * Writes scheduler cycle statistics to the USB UART.
+     * Returns false when the firmware is built without scheduler profiling.
+     */
+    bool app_dumpSchedulerProfile(void);
+
+    /**
+     * Sends the buffered scheduler trace to the USB UART.
+     * Returns false when the firmware is built without scheduler tracing.
+     */
+    bool app_dumpTrace(void);
+
 #ifdef __cplusplus
 }
 #endif
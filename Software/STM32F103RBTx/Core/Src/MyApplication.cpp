@@ -25,6 +25,7 @@ import Driver.KeyboardDriver;
 import Driver.UartDriver;
 import Driver.SdCardDriver;
 import Driver.PulseCounterDriver;
+import Driver.IsrEvent;
 
 // Static concrete driver instances
 static Driver::LightSensorDriver lightSensor{hadc1};
@@ -68,6 +69,10 @@ extern "C"
 
     bool app_init()
     {
+        Driver::IsrEventNotifier::registerCallback(
+            [](Driver::IsrEvent event) noexcept
+            { facade.onIsrEvent(event); });
+
         return facade.init();
     }
 
@@ -86,4 +91,24 @@ extern "C"
         facade.onTimeSlot();
     }
 
+    void app_timeSlotsElapsedIsr(uint32_t elapsedSlots)
+    {
+        facade.onTimeSlotsElapsed(elapsedSlots);
+    }
+
+    uint32_t app_getIdleSlots(uint32_t maxSlots)
+    {
+        return facade.getIdleSlots(maxSlots);
+    }
+
+    bool app_dumpSchedulerProfile()
+    {
+        return facade.dumpSchedulerProfile();
+    }
+
+    bool app_dumpTrace()
+    {
+        return facade.dumpTrace();
+    }
+
 } // extern "C"
\ No newline at end of file
@@ -67,6 +67,13 @@ WWDG_HandleTypeDef hwwdg;
 /* USER CODE BEGIN PV */
 
 volatile uint8_t app_tick_flag = 0;
+
+#if defined(HDL_TICKLESS_IDLE)
+/* TIM2 counts one scheduler slot in (Init.Period + 1) ticks; ARR is 16-bit on STM32F103. */
+#define TIM2_SLOT_TICKS (htim2.Init.Period + 1U)
+#define TIM2_MAX_IDLE_SLOTS ((0xFFFFU + 1U) / TIM2_SLOT_TICKS)
+#endif
+
 /**
  * @brief Period elapsed callback in non-blocking mode
  * @param htim TIM handle
@@ -76,8 +83,16 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   if (htim->Instance == TIM2)
   {
+#if defined(HDL_TICKLESS_IDLE)
+    // The main loop may have stretched the period over empty slots; report all of them and
+    // return to one slot per period so a busy main loop keeps the normal 5 ms cadence.
+    const uint32_t elapsedSlots = (__HAL_TIM_GET_AUTORELOAD(htim) + 1U) / TIM2_SLOT_TICKS;
+    __HAL_TIM_SET_AUTORELOAD(htim, htim2.Init.Period);
+    app_timeSlotsElapsedIsr(elapsedSlots);
+#else
     app_timeSlotIsr();
-    app_tick_flag = 1; // Set flag every 5ms
+#endif
+    app_tick_flag = 1; // Set flag every 5ms (or at the end of a tickless idle period)
   }
 }
 
@@ -189,10 +204,31 @@ int main(void)
     {
       app_tick_flag = 0U;
       app_tick();
+#if defined(HDL_SCHEDULER_TRACE)
+      // Drained every slot so the trace ring does not overflow; the blocking UART transfer
+      // delays the next slots, which the scheduler catches up on.
+      app_dumpTrace();
+#endif
     }
     else
     {
+#if defined(HDL_TICKLESS_IDLE)
+      // Masked so a TIM2 update between the flag check and WFI cannot be missed;
+      // a pending interrupt still wakes WFI and is taken after __enable_irq().
+      __disable_irq();
+      // An update already pending belongs to the one-slot period: stretching ARR now would make
+      // the ISR count the stretched period, so take it first and sleep on the next loop pass.
+      if ((app_tick_flag == 0U) && (__HAL_TIM_GET_FLAG(&htim2, TIM_FLAG_UPDATE) == RESET))
+      {
+        // ARR preload is disabled: the stretched period counts from the last update event.
+        const uint32_t idleSlots = app_getIdleSlots(TIM2_MAX_IDLE_SLOTS);
+        __HAL_TIM_SET_AUTORELOAD(&htim2, (idleSlots * TIM2_SLOT_TICKS) - 1U);
+        __WFI();
+      }
+      __enable_irq();
+#else
       __WFI(); // Sleep until any interrupt occurs (e.g., TIM2 sets app_tick_flag)
+#endif
     }
     /* USER CODE END WHILE */
 